@@ -0,0 +1,65 @@
+/**
+ * Arduino.h stand-in for the native (host) build. Covers only what the
+ * portable terminal modules and VOID_HAL use.
+ */
+
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#include <chrono>
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+
+// The ESP32 core pulls these in through Arduino.h as well
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#define IRAM_ATTR
+
+inline uint32_t micros() { return (uint32_t)esp_timer_get_time(); }
+inline uint32_t millis() { return (uint32_t)(esp_timer_get_time() / 1000); }
+inline void delay(uint32_t ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+class String {
+public:
+  String(const char *s = "") : _s(s ? s : "") {}
+  const char *c_str() const { return _s.c_str(); }
+  size_t length() const { return _s.size(); }
+  bool isEmpty() const { return _s.empty(); }
+  bool operator==(const char *s) const { return _s == s; }
+  String &operator+=(const char *s) {
+    _s += s;
+    return *this;
+  }
+
+private:
+  std::string _s;
+};
+
+class NativeSerial {
+public:
+  void begin(unsigned long) {}
+  int printf(const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vprintf(fmt, ap);
+    va_end(ap);
+    return n;
+  }
+  size_t print(const char *s) { return fputs(s, stdout), strlen(s); }
+  size_t println(const char *s = "") { return printf("%s\n", s); }
+};
+
+extern NativeSerial Serial;
+
+#endif // NATIVE_ARDUINO_H
@@ -0,0 +1,30 @@
+/**
+ * LilyGoLib stand-in for the native build. Only the surface VOID_HAL
+ * drives: haptics, backlight and the BQ27220 gauge, with fixed readings.
+ */
+
+#ifndef NATIVE_LILYGOLIB_H
+#define NATIVE_LILYGOLIB_H
+
+#include "Arduino.h"
+
+class NativeGauge {
+public:
+  bool refresh() { return true; }
+  uint16_t getVoltage() { return 3900; } // mV
+  uint16_t getStateOfCharge() { return 80; }
+  int16_t getCurrent() { return -120; } // mA
+  float getTemperature() { return 25.0f; }
+};
+
+class LilyGoLoRaPager {
+public:
+  bool begin() { return true; }
+  void loop() {}
+  void setHapticEffects(uint8_t) {}
+  void vibrator() {}
+  void setBrightness(uint8_t) {}
+  NativeGauge gauge;
+};
+
+#endif // NATIVE_LILYGOLIB_H
@@ -0,0 +1,14 @@
+#ifndef NATIVE_ESP_TIMER_H
+#define NATIVE_ESP_TIMER_H
+
+#include <chrono>
+#include <stdint.h>
+
+// Microseconds since first use, like esp_timer's time since boot
+inline int64_t esp_timer_get_time() {
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return duration_cast<microseconds>(steady_clock::now() - start).count();
+}
+
+#endif // NATIVE_ESP_TIMER_H
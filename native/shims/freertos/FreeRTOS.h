@@ -0,0 +1,56 @@
+/**
+ * FreeRTOS stand-in for the native build: ticks are milliseconds of host
+ * steady time, critical sections are plain mutexes.
+ */
+
+#ifndef NATIVE_FREERTOS_H
+#define NATIVE_FREERTOS_H
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS 1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define tskIDLE_PRIORITY 0
+#define tskNO_AFFINITY -1
+
+struct portMUX_TYPE {
+  std::mutex m;
+};
+#define portMUX_INITIALIZER_UNLOCKED {}
+#define portENTER_CRITICAL(mux) (mux)->m.lock()
+#define portEXIT_CRITICAL(mux) (mux)->m.unlock()
+#define portENTER_CRITICAL_ISR(mux) portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux) portEXIT_CRITICAL(mux)
+
+inline TickType_t native_ticks() {
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return (TickType_t)duration_cast<milliseconds>(steady_clock::now() - start)
+      .count();
+}
+
+// Wait on cv until pred() or the tick timeout expires. Caller holds lk.
+template <typename Pred>
+bool native_wait(std::condition_variable &cv, std::unique_lock<std::mutex> &lk,
+                 TickType_t ticks, Pred pred) {
+  if (ticks == portMAX_DELAY) {
+    cv.wait(lk, pred);
+    return true;
+  }
+  return cv.wait_for(lk, std::chrono::milliseconds(ticks), pred);
+}
+
+#endif // NATIVE_FREERTOS_H
@@ -0,0 +1,78 @@
+/**
+ * FreeRTOS semaphore stand-in covering binary, counting-as-binary and
+ * (recursive) mutex use.
+ */
+
+#ifndef NATIVE_FREERTOS_SEMPHR_H
+#define NATIVE_FREERTOS_SEMPHR_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+struct NativeSemaphore {
+  std::mutex m;
+  std::condition_variable cv;
+  uint32_t count;
+  TaskHandle_t owner = nullptr; // Recursive mutex owner
+  uint32_t depth = 0;
+  explicit NativeSemaphore(uint32_t initial) : count(initial) {}
+};
+typedef NativeSemaphore *SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary() {
+  return new NativeSemaphore(0);
+}
+inline SemaphoreHandle_t xSemaphoreCreateMutex() {
+  return new NativeSemaphore(1);
+}
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() {
+  return new NativeSemaphore(1);
+}
+inline void vSemaphoreDelete(SemaphoreHandle_t s) { delete s; }
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks) {
+  std::unique_lock<std::mutex> lk(s->m);
+  if (!native_wait(s->cv, lk, ticks, [s] { return s->count > 0; }))
+    return pdFALSE;
+  s->count--;
+  return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+  std::lock_guard<std::mutex> lk(s->m);
+  if (s->count)
+    return pdFALSE; // Binary: already given
+  s->count = 1;
+  s->cv.notify_one();
+  return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t s,
+                                          TickType_t ticks) {
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> lk(s->m);
+  if (s->owner == self) {
+    s->depth++;
+    return pdTRUE;
+  }
+  if (!native_wait(s->cv, lk, ticks, [s] { return s->count > 0; }))
+    return pdFALSE;
+  s->count = 0;
+  s->owner = self;
+  s->depth = 1;
+  return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t s) {
+  std::lock_guard<std::mutex> lk(s->m);
+  if (s->owner != xTaskGetCurrentTaskHandle())
+    return pdFALSE;
+  if (--s->depth == 0) {
+    s->owner = nullptr;
+    s->count = 1;
+    s->cv.notify_one();
+  }
+  return pdTRUE;
+}
+
+#endif // NATIVE_FREERTOS_SEMPHR_H
@@ -0,0 +1,84 @@
+/**
+ * FreeRTOS task stand-in: each task is a detached std::thread with a
+ * notification counter. Priorities and core affinity are ignored.
+ */
+
+#ifndef NATIVE_FREERTOS_TASK_H
+#define NATIVE_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+#include <pthread.h>
+#include <thread>
+
+struct NativeTask {
+  std::mutex m;
+  std::condition_variable cv;
+  uint32_t notify = 0;
+};
+typedef NativeTask *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+inline TaskHandle_t &native_current_task() {
+  static thread_local TaskHandle_t self = nullptr;
+  return self;
+}
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle() {
+  TaskHandle_t &self = native_current_task();
+  if (!self)
+    self = new NativeTask(); // Main thread or a foreign thread
+  return self;
+}
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *,
+                                          uint32_t, void *param, UBaseType_t,
+                                          TaskHandle_t *out, BaseType_t) {
+  TaskHandle_t task = new NativeTask();
+  if (out)
+    *out = task;
+  std::thread([fn, param, task]() {
+    native_current_task() = task;
+    fn(param);
+  }).detach();
+  return pdPASS;
+}
+
+inline BaseType_t xTaskCreate(TaskFunction_t fn, const char *name,
+                              uint32_t stack, void *param, UBaseType_t prio,
+                              TaskHandle_t *out) {
+  return xTaskCreatePinnedToCore(fn, name, stack, param, prio, out,
+                                 tskNO_AFFINITY);
+}
+
+inline void vTaskDelete(TaskHandle_t task) {
+  if (!task || task == native_current_task())
+    pthread_exit(nullptr); // Task functions end here instead of returning
+}
+
+inline void vTaskDelay(TickType_t ticks) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+inline TickType_t xTaskGetTickCount() { return native_ticks(); }
+inline void taskYIELD() { std::this_thread::yield(); }
+inline UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 0; }
+
+inline void xTaskNotifyGive(TaskHandle_t task) {
+  if (!task)
+    return;
+  std::lock_guard<std::mutex> lk(task->m);
+  task->notify++;
+  task->cv.notify_all();
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) {
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> lk(self->m);
+  native_wait(self->cv, lk, ticks, [self] { return self->notify > 0; });
+  uint32_t v = self->notify;
+  if (v)
+    self->notify = clear ? 0 : v - 1;
+  return v;
+}
+
+#endif // NATIVE_FREERTOS_TASK_H
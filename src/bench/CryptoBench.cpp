@@ -0,0 +1,249 @@
+/**
+ * CryptoBench - SSH/WireGuard primitive throughput on the mbedTLS build
+ */
+
+#include "CryptoBench.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <esp_system.h>
+#include <esp_timer.h>
+#include <mbedtls/aes.h>
+#include <mbedtls/bignum.h>
+#include <mbedtls/ecdh.h>
+#include <mbedtls/gcm.h>
+#include <mbedtls/md.h>
+#include <sdkconfig.h>
+#ifdef MBEDTLS_CHACHAPOLY_C
+#include <mbedtls/chachapoly.h>
+#endif
+
+#ifdef CONFIG_MBEDTLS_HARDWARE_AES
+#define HW_AES true
+#else
+#define HW_AES false
+#endif
+#ifdef CONFIG_MBEDTLS_HARDWARE_SHA
+#define HW_SHA true
+#else
+#define HW_SHA false
+#endif
+#ifdef CONFIG_MBEDTLS_HARDWARE_MPI
+#define HW_MPI true
+#else
+#define HW_MPI false
+#endif
+
+static uint32_t elapsed_us(int64_t since) {
+  return (uint32_t)(esp_timer_get_time() - since);
+}
+
+static int bench_rng(void *ctx, unsigned char *out, size_t len) {
+  (void)ctx;
+  esp_fill_random(out, len);
+  return 0;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Bulk: one call per packet, like the SSH packet layer
+// ═══════════════════════════════════════════════════════════════════════════
+
+struct Bulk {
+  uint8_t *in;
+  uint8_t *out;
+  uint8_t key[32];
+  uint8_t iv[16];
+  uint8_t tag[32];
+};
+
+typedef void (*BulkFn)(Bulk &b, void *ctx);
+
+static void run_bulk(const char *name, bool hw, Bulk &b, BulkFn fn,
+                     void *ctx) {
+  CryptoBenchResult r = {name, 0, 0, 0, hw};
+  int64_t t = esp_timer_get_time();
+  for (uint32_t done = 0; done < CRYPTO_BENCH_KB * 1024;
+       done += CRYPTO_BENCH_PACKET)
+    fn(b, ctx);
+  r.total_us = elapsed_us(t);
+  r.bytes = CRYPTO_BENCH_KB * 1024;
+  crypto_bench_print(r);
+}
+
+static void aes_ctr_packet(Bulk &b, void *ctx) {
+  size_t off = 0;
+  uint8_t block[16];
+  mbedtls_aes_crypt_ctr((mbedtls_aes_context *)ctx, CRYPTO_BENCH_PACKET,
+                        &off, b.iv, block, b.in, b.out);
+}
+
+static void aes_gcm_packet(Bulk &b, void *ctx) {
+  b.iv[11]++; // Fresh nonce per packet, as SSH's invocation counter
+  mbedtls_gcm_crypt_and_tag((mbedtls_gcm_context *)ctx, MBEDTLS_GCM_ENCRYPT,
+                            CRYPTO_BENCH_PACKET, b.iv, 12, b.iv, 4, b.in,
+                            b.out, 16, b.tag);
+}
+
+#ifdef MBEDTLS_CHACHAPOLY_C
+static void chachapoly_packet(Bulk &b, void *ctx) {
+  b.iv[11]++;
+  mbedtls_chachapoly_encrypt_and_tag((mbedtls_chachapoly_context *)ctx,
+                                     CRYPTO_BENCH_PACKET, b.iv, b.iv, 4,
+                                     b.in, b.out, b.tag);
+}
+#endif
+
+static void hmac_packet(Bulk &b, void *ctx) {
+  mbedtls_md_hmac((const mbedtls_md_info_t *)ctx, b.key, 32, b.in,
+                  CRYPTO_BENCH_PACKET, b.tag);
+}
+
+static void bench_bulk(Bulk &b) {
+  mbedtls_aes_context aes;
+  mbedtls_aes_init(&aes);
+  mbedtls_aes_setkey_enc(&aes, b.key, 128);
+  run_bulk("aes128-ctr", HW_AES, b, aes_ctr_packet, &aes);
+  mbedtls_aes_setkey_enc(&aes, b.key, 256);
+  run_bulk("aes256-ctr", HW_AES, b, aes_ctr_packet, &aes);
+  mbedtls_aes_free(&aes);
+
+  mbedtls_gcm_context gcm;
+  mbedtls_gcm_init(&gcm);
+  mbedtls_gcm_setkey(&gcm, MBEDTLS_CIPHER_ID_AES, b.key, 128);
+  run_bulk("aes128-gcm", HW_AES, b, aes_gcm_packet, &gcm);
+  mbedtls_gcm_setkey(&gcm, MBEDTLS_CIPHER_ID_AES, b.key, 256);
+  run_bulk("aes256-gcm", HW_AES, b, aes_gcm_packet, &gcm);
+  mbedtls_gcm_free(&gcm);
+
+#ifdef MBEDTLS_CHACHAPOLY_C
+  // The only cipher WireGuard has; software everywhere
+  mbedtls_chachapoly_context cp;
+  mbedtls_chachapoly_init(&cp);
+  mbedtls_chachapoly_setkey(&cp, b.key);
+  run_bulk("chacha20-poly1305", false, b, chachapoly_packet, &cp);
+  mbedtls_chachapoly_free(&cp);
+#else
+  Serial.println("crypto chacha20-poly1305 not in this mbedTLS build");
+#endif
+
+  run_bulk("hmac-sha2-256", HW_SHA, b, hmac_packet,
+           (void *)mbedtls_md_info_from_type(MBEDTLS_MD_SHA256));
+  run_bulk("hmac-sha2-512", HW_SHA, b, hmac_packet,
+           (void *)mbedtls_md_info_from_type(MBEDTLS_MD_SHA512));
+  run_bulk("hmac-sha1", HW_SHA, b, hmac_packet,
+           (void *)mbedtls_md_info_from_type(MBEDTLS_MD_SHA1));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Key exchange math
+// ═══════════════════════════════════════════════════════════════════════════
+
+// One client side of ECDH: ephemeral key pair, then the shared secret
+static void bench_ecdh(const char *name, mbedtls_ecp_group_id id) {
+  mbedtls_ecp_group grp;
+  mbedtls_mpi d, z;
+  mbedtls_ecp_point q;
+  mbedtls_ecp_group_init(&grp);
+  mbedtls_mpi_init(&d);
+  mbedtls_mpi_init(&z);
+  mbedtls_ecp_point_init(&q);
+
+  CryptoBenchResult r = {name, 0, 0, 0, false};
+  bool ok = mbedtls_ecp_group_load(&grp, id) == 0;
+  int64_t t = esp_timer_get_time();
+  for (uint32_t i = 0; ok && i < CRYPTO_BENCH_KEX_ROUNDS; i++) {
+    ok = mbedtls_ecdh_gen_public(&grp, &d, &q, bench_rng, nullptr) == 0 &&
+         mbedtls_ecdh_compute_shared(&grp, &z, &q, &d, bench_rng,
+                                     nullptr) == 0;
+    r.rounds++;
+  }
+  r.total_us = elapsed_us(t);
+  if (ok)
+    crypto_bench_print(r);
+  else
+    Serial.printf("crypto %-18s not in this mbedTLS build\n", name);
+
+  mbedtls_ecp_point_free(&q);
+  mbedtls_mpi_free(&z);
+  mbedtls_mpi_free(&d);
+  mbedtls_ecp_group_free(&grp);
+}
+
+// 2048-bit modular exponentiation: a short exponent is an RSA host key
+// signature check, a full one the client side of diffie-hellman-group14
+static void bench_modexp(const char *name, size_t exp_bits) {
+  mbedtls_mpi a, e, n, x;
+  mbedtls_mpi_init(&a);
+  mbedtls_mpi_init(&e);
+  mbedtls_mpi_init(&n);
+  mbedtls_mpi_init(&x);
+
+  CryptoBenchResult r = {name, 0, 0, 0, HW_MPI};
+  bool ok = mbedtls_mpi_fill_random(&n, 256, bench_rng, nullptr) == 0 &&
+            mbedtls_mpi_set_bit(&n, 0, 1) == 0 && // Modulus must be odd
+            mbedtls_mpi_set_bit(&n, 2047, 1) == 0 &&
+            mbedtls_mpi_fill_random(&a, 255, bench_rng, nullptr) == 0;
+  if (ok && exp_bits <= 32)
+    ok = mbedtls_mpi_lset(&e, 65537) == 0;
+  else if (ok)
+    ok = mbedtls_mpi_fill_random(&e, exp_bits / 8, bench_rng, nullptr) == 0;
+
+  int64_t t = esp_timer_get_time();
+  for (uint32_t i = 0; ok && i < CRYPTO_BENCH_KEX_ROUNDS; i++) {
+    ok = mbedtls_mpi_exp_mod(&x, &a, &e, &n, nullptr) == 0;
+    r.rounds++;
+  }
+  r.total_us = elapsed_us(t);
+  if (ok)
+    crypto_bench_print(r);
+  else
+    Serial.printf("crypto %-18s failed\n", name);
+
+  mbedtls_mpi_free(&x);
+  mbedtls_mpi_free(&n);
+  mbedtls_mpi_free(&e);
+  mbedtls_mpi_free(&a);
+}
+
+void crypto_bench_print(const CryptoBenchResult &r) {
+  const char *unit = r.hw ? "hw" : "sw";
+  if (r.bytes) {
+    float mb = r.bytes / (1024.0f * 1024.0f);
+    Serial.printf("crypto %-18s %4u KB  %6.2f MB/s  %s\n", r.name,
+                  (unsigned)(r.bytes / 1024),
+                  r.total_us ? mb / (r.total_us / 1e6f) : 0.0f, unit);
+  } else {
+    Serial.printf("crypto %-18s %4u ops  %7.2f ms/op  %s\n", r.name,
+                  (unsigned)r.rounds,
+                  r.rounds ? r.total_us / 1000.0f / r.rounds : 0.0f, unit);
+  }
+}
+
+void crypto_bench_run() {
+  Serial.printf("crypto: %u KB per cipher in %u B packets; AES %s, SHA %s, "
+                "MPI %s\n",
+                (unsigned)CRYPTO_BENCH_KB, (unsigned)CRYPTO_BENCH_PACKET,
+                HW_AES ? "hw" : "sw", HW_SHA ? "hw" : "sw",
+                HW_MPI ? "hw" : "sw");
+
+  // Internal RAM, where libssh's packet buffers live
+  Bulk b;
+  b.in = (uint8_t *)heap_caps_malloc(CRYPTO_BENCH_PACKET,
+                                     MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  b.out = (uint8_t *)heap_caps_malloc(CRYPTO_BENCH_PACKET,
+                                      MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  if (!b.in || !b.out) {
+    Serial.println("crypto: out of memory");
+  } else {
+    esp_fill_random(b.in, CRYPTO_BENCH_PACKET);
+    esp_fill_random(b.key, sizeof(b.key));
+    esp_fill_random(b.iv, sizeof(b.iv));
+    bench_bulk(b);
+  }
+  heap_caps_free(b.out);
+  heap_caps_free(b.in);
+
+  bench_ecdh("curve25519 kex", MBEDTLS_ECP_DP_CURVE25519);
+  bench_ecdh("ecdh-nistp256 kex", MBEDTLS_ECP_DP_SECP256R1);
+  bench_modexp("rsa2048 verify", 17);
+  bench_modexp("dh-group14 kex", 2048);
+}
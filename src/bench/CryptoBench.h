@@ -0,0 +1,39 @@
+#ifndef CRYPTO_BENCH_H
+#define CRYPTO_BENCH_H
+
+#include <stdint.h>
+
+/**
+ * CryptoBench
+ * Micro-benchmark of the primitives an SSH session and the WireGuard tunnel
+ * spend their time in, run through the same mbedTLS build libssh links:
+ * bulk ciphers and MACs over SSH-sized packets, then the public-key math of
+ * one key exchange. The header line tells which primitives the SDK routes
+ * to the S3's AES, SHA and MPI units.
+ *
+ * Device only (-DAVERR_CRYPTO_BENCH, results over serial). Real handshake
+ * times are measured per connect and shown by 'stats'.
+ */
+
+#ifndef CRYPTO_BENCH_KB
+#define CRYPTO_BENCH_KB 256 // Bulk bytes per cipher or MAC
+#endif
+#ifndef CRYPTO_BENCH_PACKET
+#define CRYPTO_BENCH_PACKET 1024 // Bytes per call, like a channel packet
+#endif
+#define CRYPTO_BENCH_KEX_ROUNDS 4
+
+struct CryptoBenchResult {
+  const char *name;
+  uint32_t bytes;   // Bulk: bytes processed; 0 for public-key rows
+  uint32_t rounds;  // Public-key: operations timed
+  uint32_t total_us;
+  bool hw;          // Runs on an S3 accelerator in this build
+};
+
+// Run every primitive; prints one line each
+void crypto_bench_run();
+
+void crypto_bench_print(const CryptoBenchResult &r);
+
+#endif // CRYPTO_BENCH_H
@@ -0,0 +1,307 @@
+/**
+ * TermBench - synthetic PTY corpora and the replay harness
+ */
+
+#include "TermBench.h"
+#include "ssh/ByteRing.h"
+#include "ssh/LatencyHistogram.h"
+#include "ssh/TerminalView.h"
+#include "ssh/VTParser.h"
+#include <Arduino.h>
+#include <atomic>
+#include <stdarg.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#ifdef AVERR_NATIVE
+#include <malloc.h>
+#endif
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Allocation accounting (benchmark builds only)
+// ═══════════════════════════════════════════════════════════════════════════
+
+static std::atomic<uint32_t> bench_allocs(0);
+
+#if defined(AVERR_BENCH) || defined(AVERR_NATIVE)
+void *operator new(size_t n) {
+  bench_allocs++;
+  return malloc(n ? n : 1);
+}
+void *operator new[](size_t n) {
+  bench_allocs++;
+  return malloc(n ? n : 1);
+}
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+#endif
+
+static size_t heap_in_use() {
+#ifdef AVERR_NATIVE
+  return mallinfo2().uordblks;
+#else
+  return heap_caps_get_total_size(MALLOC_CAP_8BIT) -
+         heap_caps_get_free_size(MALLOC_CAP_8BIT);
+#endif
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Corpus generators
+// ═══════════════════════════════════════════════════════════════════════════
+
+struct Corpus {
+  char *buf;
+  size_t len;
+  size_t cap;
+  uint32_t rng;
+
+  bool full() const { return len + 256 > cap; }
+
+  void put(const char *s) {
+    size_t n = strlen(s);
+    if (len + n > cap)
+      n = cap - len;
+    memcpy(buf + len, s, n);
+    len += n;
+  }
+
+  void printf(const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf + len, cap - len, fmt, ap);
+    va_end(ap);
+    if (n > 0)
+      len += (size_t)n < cap - len ? n : cap - len - 1;
+  }
+
+  uint32_t next() { // xorshift32, deterministic across runs
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+  }
+  uint32_t below(uint32_t n) { return next() % n; }
+
+  void word(int min, int max) {
+    static const char letters[] = "etaoinshrdlucmfwypvbgkqjxz";
+    int n = min + below(max - min + 1);
+    char w[32];
+    for (int i = 0; i < n && i < 31; i++)
+      w[i] = letters[below(26)];
+    w[n < 31 ? n : 31] = '\0';
+    put(w);
+  }
+};
+
+static void gen_dmesg(Corpus &c) {
+  static const char *subsys[] = {"usb 1-1", "EXT4-fs (sda1)", "wlan0",
+                                 "pci 0000:00:1f.3", "systemd[1]", "audit"};
+  uint32_t t = 0;
+  while (!c.full()) {
+    t += 1 + c.below(40000);
+    c.printf("[%5u.%06u] %s: ", t / 1000000, t % 1000000, subsys[c.below(6)]);
+    int words = 3 + c.below(9);
+    for (int i = 0; i < words; i++) {
+      c.word(2, 9);
+      c.put(" ");
+    }
+    c.put("\r\n");
+  }
+}
+
+static void gen_ls_color(Corpus &c) {
+  static const char *colors[] = {"01;34", "01;32", "01;36", "00", "01;31",
+                                 "40;33;01"};
+  while (!c.full()) {
+    int kind = c.below(6);
+    c.printf("%crwxr-xr-x %2u averroes averroes %8u Oct %2u %02u:%02u ",
+             kind == 0 ? 'd' : (kind == 2 ? 'l' : '-'), 1 + c.below(9),
+             c.below(1 << 20), 1 + c.below(28), c.below(24), c.below(60));
+    c.printf("\x1b[%sm", colors[kind]);
+    c.word(3, 14);
+    if (kind == 1)
+      c.put(".sh");
+    c.put("\x1b[0m\r\n");
+  }
+}
+
+static void gen_htop(Corpus &c) {
+  // Full-screen refreshes: cursor addressing, colour bars, process table
+  while (!c.full()) {
+    c.put("\x1b[H");
+    for (int cpu = 0; cpu < 4 && !c.full(); cpu++) {
+      int used = c.below(40);
+      c.printf("\x1b[%d;1H\x1b[36m%3d\x1b[0m[\x1b[32m", cpu + 1, cpu);
+      for (int i = 0; i < 40; i++)
+        c.put(i < used ? "|" : " ");
+      c.printf("\x1b[0m%5.1f%%]\x1b[K", used * 2.5);
+    }
+    c.printf("\x1b[6;1H\x1b[30;46m  PID USER      PRI  NI  VIRT   RES  CPU%% "
+             "Command\x1b[K\x1b[0m");
+    for (int row = 7; row <= 24 && !c.full(); row++) {
+      c.printf("\x1b[%d;1H%5u \x1b[38;5;%um%-8s\x1b[0m  20   0 %5uM %4uM "
+               "\x1b[1m%4.1f\x1b[0m ",
+               row, 100 + c.below(30000), 16 + c.below(216), "averroes",
+               c.below(2048), c.below(512), c.below(1000) / 10.0);
+      c.word(4, 12);
+      c.put("\x1b[K");
+    }
+  }
+}
+
+static void gen_vim_scroll(Corpus &c) {
+  // Alternate screen, scroll region above the status line, one new line
+  // inserted per step the way vim scrolls with a margin set
+  c.put("\x1b[?1049h\x1b[H\x1b[2J\x1b[1;23r");
+  uint32_t line = 1;
+  while (!c.full()) {
+    c.put("\x1b[23;1H\n");
+    c.printf("\x1b[23;1H\x1b[33m%4u\x1b[0m ", line++);
+    int words = 2 + c.below(8);
+    for (int i = 0; i < words; i++) {
+      if (c.below(4) == 0)
+        c.put("\x1b[1;35m");
+      c.word(2, 8);
+      c.put("\x1b[0m ");
+    }
+    c.put("\x1b[K");
+    c.printf("\x1b[24;1H\x1b[7m main.cpp [+]  %u,1  %u%% \x1b[K\x1b[0m", line,
+             line % 100);
+  }
+  c.put("\x1b[r\x1b[?1049l");
+}
+
+static void gen_cat(Corpus &c) {
+  // Long wrapped lines of plain text with occasional UTF-8
+  while (!c.full()) {
+    int words = 4 + c.below(30);
+    for (int i = 0; i < words; i++) {
+      c.word(1, 10);
+      c.put(c.below(20) == 0 ? " \xc2\xb7 " : " ");
+    }
+    c.put("\n");
+  }
+}
+
+struct CorpusDef {
+  const char *name;
+  void (*gen)(Corpus &c);
+};
+
+static const CorpusDef corpora[] = {{"dmesg", gen_dmesg},
+                                    {"ls", gen_ls_color},
+                                    {"htop", gen_htop},
+                                    {"vim", gen_vim_scroll},
+                                    {"cat", gen_cat}};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Replay
+// ═══════════════════════════════════════════════════════════════════════════
+
+static uint32_t elapsed_us(int64_t since) {
+  return (uint32_t)(esp_timer_get_time() - since);
+}
+
+bool term_bench_one(lv_obj_t *parent, const lv_font_t *font, const char *name,
+                    TermBenchResult &out) {
+  const CorpusDef *def = nullptr;
+  for (size_t i = 0; i < sizeof(corpora) / sizeof(corpora[0]); i++)
+    if (!strcmp(corpora[i].name, name))
+      def = &corpora[i];
+  if (!def)
+    return false;
+
+  // Corpus and parser live in PSRAM on the device, outside the measurement
+  size_t cap = BENCH_CORPUS_KB * 1024;
+  Corpus c = {nullptr, 0, cap, 0x9E3779B9u};
+  c.buf = (char *)heap_caps_malloc(cap, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!c.buf)
+    c.buf = (char *)heap_caps_malloc(cap, MALLOC_CAP_8BIT);
+  if (!c.buf)
+    return false;
+  def->gen(c);
+
+  VTParser *vt = new VTParser();
+  TerminalView view;
+  view.create(parent, &vt->screen(), font);
+  uint16_t cols = 80, rows = 24;
+  view.fit(cols, rows);
+  vt->screen().resize(cols, rows);
+  vt->screen().newline_mode = false; // PTY output
+  ByteRing ring;
+  ring.begin(64 * 1024);
+  lv_refr_now(NULL);
+
+  LatencyHistogram frames;
+  uint32_t parse_us = 0;
+  size_t heap_base = heap_in_use();
+  size_t heap_peak = heap_base;
+  uint32_t allocs_base = bench_allocs;
+  int64_t start = esp_timer_get_time();
+
+  size_t off = 0;
+  while (off < c.len) {
+    // Producer side: receive-task sized chunks into the ring
+    size_t n = c.len - off < 4096 ? c.len - off : 4096;
+    off += ring.write(c.buf + off, n);
+
+    // Consumer side: one frame per drain budget
+    if (ring.available() >= BENCH_FRAME_BYTES || off == c.len) {
+      int64_t t = esp_timer_get_time();
+      const char *span;
+      size_t len;
+      while ((len = ring.read_span(&span)) > 0) {
+        vt->feed(span, len);
+        ring.consume(len);
+      }
+      parse_us += elapsed_us(t);
+
+      t = esp_timer_get_time();
+      view.sync();
+      lv_refr_now(NULL);
+      frames.record(elapsed_us(t));
+
+      size_t used = heap_in_use();
+      if (used > heap_peak)
+        heap_peak = used;
+    }
+  }
+
+  out.name = def->name;
+  out.bytes = c.len;
+  out.total_us = elapsed_us(start);
+  out.parse_us = parse_us;
+  out.allocs = bench_allocs - allocs_base;
+  out.peak_heap = heap_peak - heap_base;
+  out.frames = frames.count();
+  out.frame_avg_us = frames.avg_us();
+  out.frame_max_us = frames.max_us();
+
+  lv_obj_delete(view.obj());
+  delete vt;
+  heap_caps_free(c.buf);
+  return true;
+}
+
+void term_bench_print(const TermBenchResult &r) {
+  float mb = r.bytes / (1024.0f * 1024.0f);
+  Serial.printf("bench %-6s %4u KB  parse %6.2f MB/s  e2e %6.2f MB/s  "
+                "allocs/KB %.2f  heap +%u B  frames %u avg %.2f max %.2f ms\n",
+                r.name, (unsigned)(r.bytes / 1024),
+                r.parse_us ? mb / (r.parse_us / 1e6f) : 0.0f,
+                r.total_us ? mb / (r.total_us / 1e6f) : 0.0f,
+                r.bytes ? r.allocs * 1024.0f / r.bytes : 0.0f,
+                (unsigned)r.peak_heap, (unsigned)r.frames,
+                r.frame_avg_us / 1000.0f, r.frame_max_us / 1000.0f);
+}
+
+void term_bench_run(lv_obj_t *parent, const lv_font_t *font) {
+  Serial.printf("bench: %u KB per corpus, frame every %u B\n",
+                (unsigned)BENCH_CORPUS_KB, (unsigned)BENCH_FRAME_BYTES);
+  for (size_t i = 0; i < sizeof(corpora) / sizeof(corpora[0]); i++) {
+    TermBenchResult r;
+    if (term_bench_one(parent, font, corpora[i].name, r))
+      term_bench_print(r);
+    else
+      Serial.printf("bench %-6s failed (out of memory)\n", corpora[i].name);
+  }
+}
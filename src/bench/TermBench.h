@@ -0,0 +1,47 @@
+#ifndef TERM_BENCH_H
+#define TERM_BENCH_H
+
+#include <lvgl.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * TermBench
+ * Terminal throughput benchmark. Synthetic PTY corpora shaped like real
+ * sessions (dmesg, ls --color, htop refreshes, vim scrolling, cat of a
+ * large file) are replayed through the receive path exactly as the device
+ * runs it: ByteRing -> VTParser -> TerminalGrid -> TerminalView, with a
+ * frame rendered every UI drain budget.
+ *
+ * Per corpus it reports parse and end-to-end MB/s, heap allocations per KB,
+ * peak heap growth and frame times. Runs on the host (native env, --bench)
+ * and on the device (-DAVERR_BENCH, results over serial).
+ */
+
+#ifndef BENCH_CORPUS_KB
+#define BENCH_CORPUS_KB 256
+#endif
+#define BENCH_FRAME_BYTES (8 * 1024) // Bytes parsed per frame, as on device
+
+struct TermBenchResult {
+  const char *name;
+  uint32_t bytes;
+  uint32_t parse_us;  // Time inside VTParser::feed
+  uint32_t total_us;  // Parse + sync + render + flush
+  uint32_t allocs;    // operator new calls during the run
+  uint32_t peak_heap; // Peak heap growth over the run, bytes
+  uint32_t frames;
+  uint32_t frame_avg_us;
+  uint32_t frame_max_us;
+};
+
+// Run every corpus on a view created under parent; prints one line each
+void term_bench_run(lv_obj_t *parent, const lv_font_t *font);
+
+// Run one corpus by name ("dmesg", "ls", "htop", "vim", "cat")
+bool term_bench_one(lv_obj_t *parent, const lv_font_t *font, const char *name,
+                    TermBenchResult &out);
+
+void term_bench_print(const TermBenchResult &r);
+
+#endif // TERM_BENCH_H
@@ -0,0 +1,104 @@
+/**
+ * BootTrace - per-stage boot timestamps and pinned background init jobs
+ */
+
+#include "BootTrace.h"
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <string.h>
+
+struct BootMark {
+  const char *stage;
+  uint32_t ms;
+};
+
+struct BootJobArgs {
+  const char *stage;
+  BootJob job;
+  void *ctx;
+};
+
+static BootMark marks[BOOT_MAX_MARKS];
+static uint8_t mark_count = 0;
+static portMUX_TYPE marks_mux = portMUX_INITIALIZER_UNLOCKED;
+
+void boot_mark(const char *stage) {
+  uint32_t ms = esp_timer_get_time() / 1000;
+  bool added = false;
+  portENTER_CRITICAL(&marks_mux);
+  bool seen = false;
+  for (uint8_t i = 0; i < mark_count && !seen; i++)
+    seen = strcmp(marks[i].stage, stage) == 0;
+  if (!seen && mark_count < BOOT_MAX_MARKS) {
+    marks[mark_count].stage = stage;
+    marks[mark_count].ms = ms;
+    mark_count++;
+    added = true;
+  }
+  portEXIT_CRITICAL(&marks_mux);
+  if (added)
+    Serial.printf("[BOOT] +%6u ms  %s\n", (unsigned)ms, stage);
+}
+
+uint32_t boot_ms(const char *stage) {
+  uint32_t ms = 0;
+  portENTER_CRITICAL(&marks_mux);
+  for (uint8_t i = 0; i < mark_count; i++) {
+    if (strcmp(marks[i].stage, stage) == 0) {
+      ms = marks[i].ms;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&marks_mux);
+  return ms;
+}
+
+static void boot_job_task(void *param) {
+  BootJobArgs args = *(BootJobArgs *)param;
+  free(param);
+  args.job(args.ctx);
+  boot_mark(args.stage);
+  vTaskDelete(NULL);
+}
+
+bool boot_defer(const char *stage, BootJob job, void *ctx, uint32_t stack) {
+  BootJobArgs *args = (BootJobArgs *)malloc(sizeof(BootJobArgs));
+  if (!args)
+    return false;
+  args->stage = stage;
+  args->job = job;
+  args->ctx = ctx;
+  if (xTaskCreatePinnedToCore(boot_job_task, stage, stack, args,
+                              BOOT_BG_PRIORITY, NULL, BOOT_BG_CORE) != pdPASS) {
+    // Could not spawn: run it here rather than skip it
+    free(args);
+    job(ctx);
+    boot_mark(stage);
+  }
+  return true;
+}
+
+void boot_print() {
+  BootMark copy[BOOT_MAX_MARKS];
+  portENTER_CRITICAL(&marks_mux);
+  uint8_t n = mark_count;
+  memcpy(copy, marks, n * sizeof(BootMark));
+  portEXIT_CRITICAL(&marks_mux);
+  for (uint8_t i = 0; i < n; i++)
+    Serial.printf("[BOOT] +%6u ms  %s\n", (unsigned)copy[i].ms, copy[i].stage);
+}
+
+int boot_format(char *out, size_t max) {
+  uint32_t frame = boot_ms("first_frame");
+  uint32_t shell = boot_ms("shell");
+  int len = snprintf(out, max, "Boot: frame %u ms", (unsigned)frame);
+  if (len > 0 && len < (int)max) {
+    if (shell)
+      len += snprintf(out + len, max - len, ", shell %u ms", (unsigned)shell);
+    else
+      len += snprintf(out + len, max - len, ", no shell yet");
+  }
+  return len;
+}
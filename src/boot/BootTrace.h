@@ -0,0 +1,35 @@
+#ifndef BOOT_TRACE_H
+#define BOOT_TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * BootTrace
+ * Staged boot bookkeeping. boot_mark() stamps a named stage with the time
+ * since reset (first occurrence wins), so time-to-first-frame and
+ * time-to-shell can be compared across firmware versions from the serial
+ * log. boot_defer() runs a slow init job on a task pinned to the core that
+ * does not run loop(), and marks the stage when it finishes.
+ */
+
+#define BOOT_MAX_MARKS 16
+#define BOOT_BG_CORE 0     // loop() and LVGL run on ARDUINO_RUNNING_CORE (1)
+#define BOOT_BG_STACK 8192 // FFat mount and log replay
+#define BOOT_BG_PRIORITY 2
+
+typedef void (*BootJob)(void *ctx);
+
+// Stage names must be string literals (stored by pointer)
+void boot_mark(const char *stage);
+uint32_t boot_ms(const char *stage); // 0 if not reached yet
+
+bool boot_defer(const char *stage, BootJob job, void *ctx,
+                uint32_t stack = BOOT_BG_STACK);
+
+// Every stage so far on serial: "[BOOT] +   412 ms  first_frame"
+void boot_print();
+// "frame 412 ms, shell 5210 ms" for the stats command
+int boot_format(char *out, size_t max);
+
+#endif // BOOT_TRACE_H
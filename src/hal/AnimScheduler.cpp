@@ -0,0 +1,186 @@
+/**
+ * AnimScheduler - invalidation-budgeted UI animations and frame area stats
+ */
+
+#include "AnimScheduler.h"
+#include <Arduino.h>
+#include <lvgl_private.h> // The display's invalidated areas
+
+// Per-frame serial log of the rendered area (-DAVERR_FRAME_LOG to enable)
+#ifdef AVERR_FRAME_LOG
+#define FRAME_LOG(px, inv, anim)                                              \
+  Serial.printf("[FRAME] %u px rendered, %u invalidated, %u by animations\n", \
+                (unsigned)(px), (unsigned)(inv), (unsigned)(anim))
+#else
+#define FRAME_LOG(px, inv, anim)
+#endif
+
+// One scheduled animation. LVGL's copy has the slot as its var and
+// slot_exec_cb as its callback, so it can be found and deleted by those.
+struct Slot {
+  bool used;
+  bool decorative;
+  bool running;
+  uint8_t skips; // Budget skips in a row
+  uint32_t cost; // Pixels the last step invalidated
+  int32_t rest;  // Value applied when frozen, or ANIM_REST_NONE
+  lv_obj_t *obj;
+  lv_anim_exec_xcb_t cb;
+  lv_anim_t tmpl; // Restarted from when thawed
+};
+
+static Slot slots[ANIM_MAX_SLOTS];
+static lv_display_t *sched_disp = nullptr;
+static AnimStats sched_stats = {};
+static volatile uint32_t last_input_ms = 0;
+static uint32_t frame_inv_px = 0;  // Invalidated since the last render
+static uint32_t frame_anim_px = 0; // Of which by animation steps
+
+static uint32_t area_px(const lv_area_t &a) {
+  return (uint32_t)lv_area_get_width(&a) * lv_area_get_height(&a);
+}
+
+static void slot_exec_cb(void *var, int32_t v) {
+  Slot *s = (Slot *)var;
+  if (s->decorative && s->skips < ANIM_MAX_SKIPS &&
+      frame_inv_px + s->cost > ANIM_FRAME_BUDGET_PX) {
+    s->skips++;
+    sched_stats.skipped++;
+    return;
+  }
+  s->skips = 0;
+  uint32_t before = frame_inv_px;
+  s->cb(s->obj, v);
+  s->cost = frame_inv_px - before;
+  frame_anim_px += s->cost;
+}
+
+// Effects end on their own; their slot is free again
+static void slot_completed_cb(lv_anim_t *a) {
+  Slot *s = (Slot *)a->var;
+  s->used = false;
+  s->running = false;
+}
+
+static void run(Slot &s) {
+  s.skips = 0;
+  s.cost = 0;
+  s.running = lv_anim_start(&s.tmpl) != nullptr;
+}
+
+static void stop(Slot &s) {
+  lv_anim_delete(&s, slot_exec_cb);
+  s.running = false;
+  if (s.rest != ANIM_REST_NONE)
+    s.cb(s.obj, s.rest);
+}
+
+// Every invalidation, before LVGL merges it into its list
+static void invalidate_event_cb(lv_event_t *e) {
+  const lv_area_t *a = (const lv_area_t *)lv_event_get_param(e);
+  if (a)
+    frame_inv_px += area_px(*a);
+}
+
+// Areas are joined by now: what is about to be drawn
+static void render_start_cb(lv_event_t *e) {
+  lv_display_t *disp = (lv_display_t *)lv_event_get_target(e);
+  uint32_t px = 0;
+  for (uint32_t i = 0; i < disp->inv_p; i++) {
+    if (!disp->inv_area_joined[i])
+      px += area_px(disp->inv_areas[i]);
+  }
+  FRAME_LOG(px, frame_inv_px, frame_anim_px);
+
+  AnimStats &st = sched_stats;
+  st.frames++;
+  st.last_px = px;
+  if (px > st.max_px)
+    st.max_px = px;
+  st.total_px += px;
+  st.inv_px += frame_inv_px;
+  st.anim_px += frame_anim_px;
+  frame_inv_px = 0;
+  frame_anim_px = 0;
+}
+
+void AnimScheduler::begin(lv_display_t *disp) {
+  if (!disp || sched_disp)
+    return;
+  sched_disp = disp;
+  sched_stats.screen_px =
+      (uint32_t)lv_display_get_horizontal_resolution(disp) *
+      lv_display_get_vertical_resolution(disp);
+  last_input_ms = millis();
+  lv_display_add_event_cb(disp, invalidate_event_cb,
+                          LV_EVENT_INVALIDATE_AREA, nullptr);
+  lv_display_add_event_cb(disp, render_start_cb, LV_EVENT_RENDER_START,
+                          nullptr);
+}
+
+bool AnimScheduler::start(const lv_anim_t *a, bool decorative,
+                          int32_t rest) {
+  Slot *s = nullptr;
+  for (int i = 0; i < ANIM_MAX_SLOTS && !s; i++) {
+    if (!slots[i].used)
+      s = &slots[i];
+  }
+  if (!s)
+    return false;
+  s->used = true;
+  s->decorative = decorative;
+  s->rest = rest;
+  s->obj = (lv_obj_t *)a->var;
+  s->cb = a->exec_cb;
+  s->tmpl = *a;
+  lv_anim_set_var(&s->tmpl, s);
+  lv_anim_set_exec_cb(&s->tmpl, slot_exec_cb);
+  if (!decorative)
+    lv_anim_set_completed_cb(&s->tmpl, slot_completed_cb);
+  // Decor started while idle waits for input; tick() starts it then
+  if (!decorative || !sched_stats.frozen)
+    run(*s);
+  if (!s->running && !decorative)
+    s->used = false;
+  return s->used;
+}
+
+void AnimScheduler::note_input() { last_input_ms = millis(); }
+
+void AnimScheduler::tick() {
+  bool idle = millis() - last_input_ms >= ANIM_IDLE_FREEZE_MS;
+  lv_obj_t *shown = lv_screen_active();
+  uint16_t running = 0;
+  for (int i = 0; i < ANIM_MAX_SLOTS; i++) {
+    Slot &s = slots[i];
+    if (!s.used)
+      continue;
+    if (s.decorative) {
+      bool want = !idle && lv_obj_get_screen(s.obj) == shown;
+      if (s.running && !want) {
+        stop(s);
+        sched_stats.freezes++;
+      } else if (!s.running && want) {
+        run(s);
+      }
+    }
+    running += s.running;
+  }
+  sched_stats.frozen = idle;
+  sched_stats.running = running;
+}
+
+AnimStats AnimScheduler::stats() { return sched_stats; }
+
+int AnimScheduler::format(char *out, size_t max) {
+  const AnimStats &s = sched_stats;
+  uint32_t avg = s.frames ? (uint32_t)(s.total_px / s.frames) : 0;
+  uint32_t pct = s.screen_px ? avg * 100 / s.screen_px : 0;
+  uint32_t anim = s.inv_px ? (uint32_t)(s.anim_px * 100 / s.inv_px) : 0;
+  return snprintf(out, max,
+                  "Frames %u: avg %u max %u px (%u%%), anim %u%%, skipped "
+                  "%u, %u anims%s",
+                  (unsigned)s.frames, (unsigned)avg, (unsigned)s.max_px,
+                  (unsigned)pct, (unsigned)anim, (unsigned)s.skipped,
+                  (unsigned)s.running, s.frozen ? ", idle-frozen" : "");
+}
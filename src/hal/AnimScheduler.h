@@ -0,0 +1,71 @@
+#ifndef ANIM_SCHEDULER_H
+#define ANIM_SCHEDULER_H
+
+#include <lvgl.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * AnimScheduler
+ * Runs the UI's eye-candy animations against a per-frame invalidation
+ * budget and accounts for what every frame costs to render.
+ *
+ * - Decorative animations (launcher grid, title flicker) step only while
+ *   the area invalidated since the last frame, plus what the step
+ *   invalidated last time, fits ANIM_FRAME_BUDGET_PX. A step that does not
+ *   fit is skipped; the animation is on the clock, so it catches up on
+ *   the next one. No step is skipped more than ANIM_MAX_SKIPS times in a
+ *   row.
+ * - They are stopped outright after ANIM_IDLE_FREEZE_MS without input, or
+ *   while their screen is not shown, so LVGL has no timer due and the loop
+ *   task can sleep. Input on their screen restarts them.
+ * - Effects (a glitch on click) are feedback: never skipped, but counted.
+ *
+ * LVGL task only, except note_input().
+ */
+
+#ifndef ANIM_FRAME_BUDGET_PX
+#define ANIM_FRAME_BUDGET_PX 16384 // Invalidated pixels per frame
+#endif
+#ifndef ANIM_IDLE_FREEZE_MS
+#define ANIM_IDLE_FREEZE_MS 10000 // As the loop's light-sleep idle time
+#endif
+#define ANIM_MAX_SKIPS 3
+#define ANIM_MAX_SLOTS 24
+#define ANIM_REST_NONE INT32_MIN // Frozen animations stay where they are
+
+struct AnimStats {
+  uint32_t frames;
+  uint32_t last_px; // Rendered area of the latest frame
+  uint32_t max_px;
+  uint64_t total_px;  // Rendered, after LVGL joined the areas
+  uint64_t inv_px;    // Invalidated, overlaps counted twice
+  uint64_t anim_px;   // Of which by scheduled animation steps
+  uint32_t skipped;   // Decorative steps deferred by the budget
+  uint32_t freezes;   // Decorative animations stopped by idle/hidden
+  uint16_t running;   // Animations currently scheduled
+  bool frozen;        // Decor stopped for idle
+  uint32_t screen_px; // Display area, for percentages
+};
+
+namespace AnimScheduler {
+// Call once after DisplayPipeline::begin
+void begin(lv_display_t *disp);
+// Start a copy of a (var = object, exec_cb = its callback) under the
+// scheduler; the object must outlive it. When decor is frozen its
+// callback is given rest, e.g. to leave a flicker fully lit. False if all
+// slots are taken; the animation is then not run.
+bool start(const lv_anim_t *a, bool decorative,
+           int32_t rest = ANIM_REST_NONE);
+// Input seen (any task): resets the idle clock
+void note_input();
+// Once per loop pass, before lv_timer_handler: freezes and restarts
+// decorative animations
+void tick();
+AnimStats stats();
+// "Frames 812: avg 2140 max 76800 px (2%), anim 31%, skipped 40, 16 anims"
+// for the stats command
+int format(char *out, size_t max);
+} // namespace AnimScheduler
+
+#endif // ANIM_SCHEDULER_H
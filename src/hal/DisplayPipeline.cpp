@@ -0,0 +1,160 @@
+/**
+ * DisplayPipeline - double-buffered partial bands, pushed from a flush task
+ */
+
+#include "DisplayPipeline.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <lvgl_private.h> // The LV_Helper display's flush_cb
+
+#define FLUSH_TASK_STACK 4096
+#define FLUSH_TASK_PRIORITY 6 // Above ssh_rx: LVGL may be waiting on a band
+#define FLUSH_TASK_CORE 0     // LVGL renders on the loop() core
+
+static lv_display_t *pipe_disp = nullptr;
+static lv_display_flush_cb_t panel_flush = nullptr; // LilyGoLib's push
+static TaskHandle_t flush_task = nullptr;
+static SemaphoreHandle_t flush_done = nullptr;
+
+// Band handed to the flush task; LVGL keeps at most one in flight
+static lv_area_t job_area;
+static uint8_t *job_px = nullptr;
+
+static portMUX_TYPE stats_mux = portMUX_INITIALIZER_UNLOCKED;
+static DisplayStats pipe_stats;
+
+// Frame timing, LVGL task only
+static int64_t render_start_us = 0;
+static uint32_t render_wait_us = 0;
+
+static void flush_task_fn(void *param) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    int64_t t = esp_timer_get_time();
+    panel_flush(pipe_disp, &job_area, job_px); // Ends in flush_ready
+    uint32_t us = (uint32_t)(esp_timer_get_time() - t);
+    portENTER_CRITICAL(&stats_mux);
+    pipe_stats.push.record(us);
+    pipe_stats.bands++;
+    portEXIT_CRITICAL(&stats_mux);
+    xSemaphoreGive(flush_done);
+  }
+}
+
+// LVGL task: hand the band over and go back to rendering the next one
+static void pipe_flush_cb(lv_display_t *disp, const lv_area_t *area,
+                          uint8_t *px_map) {
+  job_area = *area;
+  job_px = px_map;
+  xTaskNotifyGive(flush_task);
+}
+
+// LVGL needs the other buffer back. A give left over from an earlier band
+// only costs one more pass; the tick timeout covers a panel driver that
+// completes the band from its own DMA interrupt.
+static void pipe_wait_cb(lv_display_t *disp) {
+  int64_t t = esp_timer_get_time();
+  while (disp->flushing)
+    xSemaphoreTake(flush_done, 1);
+  render_wait_us += (uint32_t)(esp_timer_get_time() - t);
+}
+
+static void render_event_cb(lv_event_t *e) {
+  int64_t now = esp_timer_get_time();
+  if (lv_event_get_code(e) == LV_EVENT_RENDER_START) {
+    render_start_us = now;
+    render_wait_us = 0;
+    return;
+  }
+  if (!render_start_us)
+    return;
+  uint32_t us = (uint32_t)(now - render_start_us);
+  us = us > render_wait_us ? us - render_wait_us : 0;
+  render_start_us = 0;
+  portENTER_CRITICAL(&stats_mux);
+  pipe_stats.render.record(us);
+  portEXIT_CRITICAL(&stats_mux);
+}
+
+bool DisplayPipeline::begin(lv_display_t *disp) {
+  if (!disp || pipe_disp || !disp->flush_cb)
+    return false;
+
+  // Two bands of the same height, halved until internal DMA RAM has room
+  uint32_t px_size =
+      lv_color_format_get_size(lv_display_get_color_format(disp));
+  uint32_t width = lv_display_get_horizontal_resolution(disp);
+  uint16_t lines = DISPLAY_BAND_LINES;
+  size_t bytes = 0;
+  uint8_t *a = nullptr;
+  uint8_t *b = nullptr;
+  for (; lines >= DISPLAY_MIN_BAND_LINES; lines /= 2) {
+    bytes = (size_t)width * lines * px_size;
+    a = (uint8_t *)heap_caps_malloc(bytes, MALLOC_CAP_DMA |
+                                               MALLOC_CAP_INTERNAL);
+    b = (uint8_t *)heap_caps_malloc(bytes, MALLOC_CAP_DMA |
+                                               MALLOC_CAP_INTERNAL);
+    if (a && b)
+      break;
+    heap_caps_free(a);
+    heap_caps_free(b);
+    a = b = nullptr;
+  }
+
+  if (a)
+    flush_done = xSemaphoreCreateBinary();
+  if (flush_done &&
+      xTaskCreatePinnedToCore(flush_task_fn, "lcd_flush", FLUSH_TASK_STACK,
+                              nullptr, FLUSH_TASK_PRIORITY, &flush_task,
+                              FLUSH_TASK_CORE) != pdPASS)
+    flush_task = nullptr;
+  if (!flush_task) {
+    Serial.println("[DISPLAY] No DMA RAM for draw bands, LV_Helper buffers "
+                   "kept");
+    heap_caps_free(a);
+    heap_caps_free(b);
+    if (flush_done)
+      vSemaphoreDelete(flush_done);
+    flush_done = nullptr;
+    return false;
+  }
+
+  // LV_Helper's buffers stay allocated: it owns them, and nothing else
+  // knows how they were made
+  panel_flush = disp->flush_cb;
+  pipe_disp = disp;
+  lv_display_set_buffers(disp, a, b, bytes, LV_DISPLAY_RENDER_MODE_PARTIAL);
+  lv_display_set_flush_cb(disp, pipe_flush_cb);
+  lv_display_set_flush_wait_cb(disp, pipe_wait_cb);
+  lv_display_add_event_cb(disp, render_event_cb, LV_EVENT_RENDER_START,
+                          nullptr);
+  lv_display_add_event_cb(disp, render_event_cb, LV_EVENT_RENDER_READY,
+                          nullptr);
+  pipe_stats.band_lines = lines;
+  Serial.printf("[DISPLAY] %u-line bands x2 in DMA RAM (%u B each)\n",
+                (unsigned)lines, (unsigned)bytes);
+  return true;
+}
+
+DisplayStats DisplayPipeline::stats() {
+  portENTER_CRITICAL(&stats_mux);
+  DisplayStats s = pipe_stats;
+  portEXIT_CRITICAL(&stats_mux);
+  return s;
+}
+
+int DisplayPipeline::format(char *out, size_t max) {
+  DisplayStats s = stats();
+  if (!s.band_lines)
+    return snprintf(out, max, "Display LV_Helper buffers");
+  return snprintf(out, max,
+                  "Display %u-line x2: render avg %.1f max %.1f ms, push "
+                  "avg %.1f max %.1f ms",
+                  (unsigned)s.band_lines, s.render.avg_us() / 1000.0,
+                  s.render.max_us() / 1000.0, s.push.avg_us() / 1000.0,
+                  s.push.max_us() / 1000.0);
+}
@@ -0,0 +1,43 @@
+#ifndef DISPLAY_PIPELINE_H
+#define DISPLAY_PIPELINE_H
+
+#include "../ssh/LatencyHistogram.h"
+#include <lvgl.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * DisplayPipeline
+ * Takes over the draw buffers LV_Helper set up: two partial bands in
+ * DMA-capable internal SRAM, pushed to the panel by a flush task on the
+ * other core. LVGL renders the next band into one buffer while the
+ * previous one is still being sent from the other.
+ *
+ * The push itself stays LilyGoLib's flush callback, now run on the flush
+ * task instead of inside lv_timer_handler. The pager's ST7796 has no TE
+ * line wired, so frames cannot be timed to the panel scan; narrow bands
+ * keep each visible update short instead.
+ */
+
+#ifndef DISPLAY_BAND_LINES
+#define DISPLAY_BAND_LINES 32 // Rows per draw buffer; two are allocated
+#endif
+#define DISPLAY_MIN_BAND_LINES 8 // Bands halve down to this if RAM is short
+
+struct DisplayStats {
+  uint16_t band_lines;     // 0 = LV_Helper buffers still in use
+  uint32_t bands;          // Flushes
+  LatencyHistogram render; // Per frame, excluding waits for the panel
+  LatencyHistogram push;   // Per band, panel transfer on the flush task
+};
+
+namespace DisplayPipeline {
+// Call once after beginLvglHelper, before the first refresh
+bool begin(lv_display_t *disp);
+DisplayStats stats();
+// "Display 32-line x2: render avg 4.1 max 9.8 ms, push avg 3.0 max 3.4 ms"
+// for the stats command
+int format(char *out, size_t max);
+} // namespace DisplayPipeline
+
+#endif // DISPLAY_PIPELINE_H
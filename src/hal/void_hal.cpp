@@ -4,6 +4,31 @@
 extern LilyGoLoRaPager &instance;
 
 SemaphoreHandle_t VOID_HAL::_i2c_mutex = NULL;
+TaskHandle_t VOID_HAL::_haptic_task = NULL;
+std::atomic<uint32_t> VOID_HAL::_haptic_pending(0);
+std::atomic<uint32_t> VOID_HAL::_haptic_requested(0);
+std::atomic<uint32_t> VOID_HAL::_haptic_played(0);
+
+TaskHandle_t VOID_HAL::_power_task = NULL;
+VOID_HAL::PowerSnapshot VOID_HAL::_power = {0, 0, 0, 0, 0};
+static portMUX_TYPE power_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Compact history ring, written by the sampler only
+struct PowerSample {
+  int16_t mv;
+  int16_t ma;
+  int16_t deci_c;
+};
+static PowerSample power_ring[POWER_HISTORY_LEN];
+static uint16_t power_ring_head = 0;
+static uint16_t power_ring_count = 0;
+
+#define POWER_TASK_STACK 3072
+#define POWER_TASK_PRIORITY 1
+
+#define HAPTIC_TASK_STACK 3072
+#define HAPTIC_TASK_PRIORITY 1 // Below the UI loop and network tasks
+#define HAPTIC_MIN_GAP_MS 40   // Bursts inside this window become one click
 
 void VOID_HAL::begin() {
   if (!_i2c_mutex) {
@@ -13,6 +38,18 @@ void VOID_HAL::begin() {
   lock();
   instance.begin();
   unlock();
+
+  if (!_haptic_task) {
+    xTaskCreate(haptic_task, "haptics", HAPTIC_TASK_STACK, NULL,
+                HAPTIC_TASK_PRIORITY, &_haptic_task);
+  }
+
+  // First reading inline so the status bar has data at boot
+  samplePower();
+  if (!_power_task) {
+    xTaskCreate(power_task, "telemetry", POWER_TASK_STACK, NULL,
+                POWER_TASK_PRIORITY, &_power_task);
+  }
 }
 
 void VOID_HAL::loop() {
@@ -34,10 +71,42 @@ void VOID_HAL::unlock() {
 }
 
 void VOID_HAL::vibrate(uint32_t effect) {
+  if (!effect)
+    return;
+  _haptic_requested++;
+  if (!_haptic_task) {
+    playEffect(effect); // Worker not started yet (before begin())
+    return;
+  }
+  _haptic_pending.store(effect, std::memory_order_release);
+  xTaskNotifyGive(_haptic_task);
+}
+
+void VOID_HAL::playEffect(uint32_t effect) {
   lock();
   instance.setHapticEffects(effect);
   instance.vibrator();
   unlock();
+  _haptic_played++;
+}
+
+void VOID_HAL::haptic_task(void *param) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    uint32_t effect = _haptic_pending.exchange(0, std::memory_order_acquire);
+    if (effect)
+      playEffect(effect);
+    // Let a burst of detents pile up behind this one, then take the latest
+    vTaskDelay(pdMS_TO_TICKS(HAPTIC_MIN_GAP_MS));
+  }
+}
+
+VOID_HAL::HapticStats VOID_HAL::getHapticStats() {
+  HapticStats s;
+  s.requested = _haptic_requested;
+  s.played = _haptic_played;
+  s.coalesced = s.requested > s.played ? s.requested - s.played : 0;
+  return s;
 }
 
 void VOID_HAL::setHapticEffect(uint8_t effect) {
@@ -46,24 +115,84 @@ void VOID_HAL::setHapticEffect(uint8_t effect) {
   unlock();
 }
 
-float VOID_HAL::getBatteryVoltage() {
+void VOID_HAL::samplePower() {
+  // One lock for the whole gauge transaction
   lock();
-  float v = instance.gauge.getVoltage() / 1000.0;
+  instance.gauge.refresh();
+  int mv = instance.gauge.getVoltage();
+  int soc = instance.gauge.getStateOfCharge();
+  int ma = instance.gauge.getCurrent();
+  float temp = instance.gauge.getTemperature();
   unlock();
-  return v;
+
+  PowerSnapshot snap = {mv / 1000.0f, soc, ma, temp, millis()};
+  PowerSample ps = {(int16_t)mv, (int16_t)ma, (int16_t)(temp * 10)};
+
+  // Publish snapshot and history together; readers copy under the same
+  // spinlock, so they never see a half-written sample
+  portENTER_CRITICAL(&power_mux);
+  _power = snap;
+  power_ring[power_ring_head] = ps;
+  power_ring_head = (power_ring_head + 1) % POWER_HISTORY_LEN;
+  if (power_ring_count < POWER_HISTORY_LEN)
+    power_ring_count++;
+  portEXIT_CRITICAL(&power_mux);
 }
 
-int VOID_HAL::getBatteryPercent() {
-  lock();
-  int p = instance.gauge.getStateOfCharge();
-  unlock();
-  return p;
+void VOID_HAL::power_task(void *param) {
+  for (;;) {
+    // Periodic, or early when refreshPower() asks for it
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(POWER_SAMPLE_INTERVAL_MS));
+    samplePower();
+  }
+}
+
+VOID_HAL::PowerSnapshot VOID_HAL::getPower() {
+  portENTER_CRITICAL(&power_mux);
+  PowerSnapshot snap = _power;
+  portEXIT_CRITICAL(&power_mux);
+  return snap;
+}
+
+static void range_add(VOID_HAL::PowerRange &r, float v, bool first) {
+  if (first || v < r.min)
+    r.min = v;
+  if (first || v > r.max)
+    r.max = v;
+  r.avg += v;
+}
+
+VOID_HAL::PowerHistory VOID_HAL::getPowerHistory() {
+  PowerSample copy[POWER_HISTORY_LEN];
+  uint16_t n;
+  portENTER_CRITICAL(&power_mux);
+  n = power_ring_count;
+  memcpy(copy, power_ring, sizeof(copy));
+  portEXIT_CRITICAL(&power_mux);
+
+  PowerHistory h;
+  memset(&h, 0, sizeof(h));
+  h.samples = n;
+  for (uint16_t i = 0; i < n; i++) {
+    range_add(h.voltage, copy[i].mv / 1000.0f, i == 0);
+    range_add(h.current_ma, copy[i].ma, i == 0);
+    range_add(h.temperature_c, copy[i].deci_c / 10.0f, i == 0);
+  }
+  if (n) {
+    h.voltage.avg /= n;
+    h.current_ma.avg /= n;
+    h.temperature_c.avg /= n;
+  }
+  return h;
 }
 
+float VOID_HAL::getBatteryVoltage() { return getPower().voltage; }
+
+int VOID_HAL::getBatteryPercent() { return getPower().percent; }
+
 void VOID_HAL::refreshPower() {
-  lock();
-  instance.gauge.refresh();
-  unlock();
+  if (_power_task)
+    xTaskNotifyGive(_power_task);
 }
 
 void VOID_HAL::setBrightness(uint8_t level) {
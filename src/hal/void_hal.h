@@ -3,8 +3,15 @@
 
 #include <Arduino.h>
 #include <LilyGoLib.h>
+#include <atomic>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#ifndef POWER_SAMPLE_INTERVAL_MS
+#define POWER_SAMPLE_INTERVAL_MS 2000
+#endif
+#define POWER_HISTORY_LEN 64 // ~2 minutes at the default interval
 
 /**
  * VOID-HAL (Hardware Abstraction Layer)
@@ -17,14 +24,42 @@ public:
   static void begin();
   static void loop();
 
-  // Haptics
+  // Haptics. vibrate() is fire-and-forget: it posts the effect to a
+  // low-priority worker and returns without touching I2C. Requests that
+  // arrive while an effect is pending or playing collapse into the latest.
+  struct HapticStats {
+    uint32_t requested; // vibrate() calls
+    uint32_t played;    // Effects actually driven on the DRV2605
+    uint32_t coalesced; // Requests merged into a later one
+  };
   static void vibrate(uint32_t effect = 1);
   static void setHapticEffect(uint8_t effect);
+  static HapticStats getHapticStats();
 
-  // Battery/Power
+  // Battery/Power. A low-priority sampler reads the BQ27220 once per
+  // interval under a single lock and publishes a snapshot; readers never
+  // touch I2C.
+  struct PowerSnapshot {
+    float voltage;       // V
+    int percent;         // State of charge, %
+    int current_ma;      // Negative while discharging
+    float temperature_c; // Gauge temperature
+    uint32_t sampled_ms; // millis() of the sample, 0 = none yet
+  };
+  struct PowerRange {
+    float min, max, avg;
+  };
+  struct PowerHistory {
+    uint16_t samples; // Samples in the window (newest POWER_HISTORY_LEN)
+    PowerRange voltage;
+    PowerRange current_ma;
+    PowerRange temperature_c;
+  };
+  static PowerSnapshot getPower();
+  static PowerHistory getPowerHistory();
   static float getBatteryVoltage();
   static int getBatteryPercent();
-  static void refreshPower();
+  static void refreshPower(); // Ask the sampler for a fresh reading now
 
   // Display
   static void setBrightness(uint8_t level);
@@ -39,6 +74,18 @@ public:
 
 private:
   static SemaphoreHandle_t _i2c_mutex;
+
+  static TaskHandle_t _haptic_task;
+  static std::atomic<uint32_t> _haptic_pending; // Latest effect, 0 = none
+  static std::atomic<uint32_t> _haptic_requested;
+  static std::atomic<uint32_t> _haptic_played;
+  static void haptic_task(void *param);
+  static void playEffect(uint32_t effect);
+
+  static TaskHandle_t _power_task;
+  static PowerSnapshot _power;
+  static void power_task(void *param);
+  static void samplePower();
 };
 
 #endif // VOID_HAL_H
@@ -4,17 +4,32 @@
  * Adapted for LilyGo T-LoRa-Pager hardware
  *
  * Control Scheme:
- *   - Rotary Rotation: Navigate command history
- *   - Rotary Press: Execute current input (Enter)
- *   - Rotary Long Press: Delete current history entry
+ *   - Rotary Rotation: Navigate command history (or output in scroll mode)
+ *   - Rotary Press: Execute current input (Enter) / leave scroll mode
+ *   - Rotary Long Press: Delete current history entry, or toggle scroll
+ *     mode when no history entry is selected. In scroll mode typing
+ *     searches the output and rotation jumps between matches
  *   - Keyboard: Full QWERTY input
  */
 
+#include "boot/BootTrace.h"
+#include "hal/AnimScheduler.h"
+#include "hal/DisplayPipeline.h"
 #include "hal/void_hal.h"
+#ifdef AVERR_BENCH
+#include "bench/TermBench.h"
+#endif
+#ifdef AVERR_CRYPTO_BENCH
+#include "bench/CryptoBench.h"
+#endif
 #include "ssh/ssh_terminal.h"
 #include <Arduino.h>
 #include <LV_Helper.h>
 #include <LilyGoLib.h>
+#include <driver/gpio.h>
+#include <esp_freertos_hooks.h>
+#include <esp_sleep.h>
+#include <soc/gpio_struct.h>
 
 // Global SSH Terminal instance
 static SSHTerminal *sshTerminal = nullptr;
@@ -48,6 +63,35 @@ static bool lastButtonState = false;
 static uint32_t buttonPressStart = 0;
 static bool longPressHandled = false;
 #define LONG_PRESS_MS 1000
+#define DEBOUNCE_MS 50
+#define SCROLL_LINES_PER_DETENT 3
+
+// Tickless loop: encoder, button, keyboard and UI mailbox wake the loop
+// task; otherwise it blocks until the next LVGL timer is due
+#define LOOP_MAX_WAIT_MS 1000 // HAL poll, log flush
+#define STATUS_UPDATE_MS 5000
+#ifndef LOOP_LIGHT_SLEEP
+#define LOOP_LIGHT_SLEEP 1 // 0 keeps USB serial up while idle
+#endif
+#define LOOP_IDLE_SLEEP_MS 10000 // No input for this long, then light sleep
+#define LOOP_SLEEP_MAX_MS 2000   // Timer wake from light sleep
+
+static TaskHandle_t loopTask = nullptr;
+static volatile bool kbArmed = false; // Idle hook may report KB_INT low
+static uint32_t lastInputMs = 0;
+
+static void markInput() {
+  lastInputMs = millis();
+  AnimScheduler::note_input();
+}
+
+static void IRAM_ATTR wakeLoopFromISR() {
+  BaseType_t woken = pdFALSE;
+  if (loopTask)
+    vTaskNotifyGiveFromISR(loopTask, &woken);
+  if (woken)
+    portYIELD_FROM_ISR();
+}
 
 // Encoder ISR
 void IRAM_ATTR encISR() {
@@ -56,10 +100,24 @@ void IRAM_ATTR encISR() {
   int b = digitalRead(ROTARY_B);
   if (a != lastA) {
     encPos += (b != a) ? 1 : -1;
+    wakeLoopFromISR();
   }
   lastA = a;
 }
 
+void IRAM_ATTR buttonISR() { wakeLoopFromISR(); }
+
+// KB_INT belongs to the keyboard driver's own interrupt, so its level is
+// watched from the idle task instead: the TCA8418 holds it low while its
+// FIFO has events. Runs once per idle tick, costs one GPIO read.
+static bool kbIdleHook() {
+  if (kbArmed && loopTask && !digitalRead(KB_INT)) {
+    kbArmed = false;
+    xTaskNotifyGive(loopTask);
+  }
+  return true;
+}
+
 // Custom Keyboard Config for TCA8418
 static const char keymap[4][10] = {
     {'q', 'w', 'e', 'r', 't', 'y', 'u', 'i', 'o', 'p'},
@@ -84,20 +142,48 @@ static const LilyGoKeyboardConfigure_t myKeyboardConfig = {
     .backspace_value = 0x1D,
     .has_symbol_key = true};
 
+// Per-key serial logging, off by default (-DAVERR_KEY_LOG to enable)
+#ifdef AVERR_KEY_LOG
+#define KEY_LOG(c) Serial.printf("[KEY] %c (0x%02X)\n", c, c)
+#else
+#define KEY_LOG(c)
+#endif
+
 // Keyboard callback for characters
 void onKeyPress(int state, char &c) {
+  markInput();
   if (state == 1 && sshTerminal) { // KB_PRESSED
-    lvgl_lock();
-    // Haptic feedback
-    VOID_HAL::vibrate(1);
+    VOID_HAL::vibrate(1); // Queued to the haptics worker, returns at once
+    KEY_LOG(c);
 
-    // Pass to SSH Terminal
-    Serial.printf("[KEY] %c (0x%02X)\n", c, c);
+    // Editing keys only touch the line buffer and the UI mailbox; Enter may
+    // run a local command that drives LVGL directly, so it takes the lock.
+    bool enter = c == '\n' || c == '\r';
+    if (enter)
+      lvgl_lock();
     sshTerminal->handle_key_input(c);
-    lvgl_unlock();
+    if (enter)
+      lvgl_unlock();
   }
 }
 
+// Boot jobs for the second core (see BootTrace)
+static void boot_load_persistent(void *ctx) {
+  ((SSHTerminal *)ctx)->load_persistent();
+}
+
+static void boot_load_profiles(void *ctx) {
+  ((SSHTerminal *)ctx)->preload_profiles();
+}
+
+/**
+ * Staged boot: only what the first frame needs runs before it is painted.
+ *   1. HAL, display and the launcher screen -> first frame
+ *   2. Keyboard, terminal screen, encoder (loop() task)
+ *   3. WiFi join, history/session replay and profile reads run in the
+ *      background on core 0 while the launcher is already usable
+ * Each stage is stamped with boot_mark() on serial.
+ */
 void setup() {
   Serial.begin(115200);
   Serial.println("AVERROES SSH TERMINAL BOOTING...");
@@ -107,6 +193,42 @@ void setup() {
 
   // Set brightness
   VOID_HAL::setBrightness(150);
+  boot_mark("hal");
+
+  // Initialize Display & LVGL
+  beginLvglHelper(instance);
+  // Double-buffered DMA bands and an off-core flush instead of LV_Helper's
+  DisplayPipeline::begin(lv_display_get_default());
+  AnimScheduler::begin(lv_display_get_default());
+  boot_mark("display");
+
+#ifdef AVERR_BENCH
+  // Terminal throughput benchmark on the real panel, then normal boot
+  lvgl_lock();
+  term_bench_run(lv_screen_active(), &lv_font_montserrat_12);
+  lvgl_unlock();
+#endif
+
+#ifdef AVERR_CRYPTO_BENCH
+  // SSH/WireGuard primitive throughput, then normal boot
+  crypto_bench_run();
+#endif
+
+  // Launcher first, painted before anything else is initialized
+  sshTerminal = new SSHTerminal();
+  lvgl_lock();
+  sshTerminal->create_launcher_screen();
+  sshTerminal->show_launcher();
+  sshTerminal->service_ui();
+  lv_refr_now(NULL);
+  lvgl_unlock();
+  boot_mark("first_frame");
+
+  // Slow, independent work goes to the other core. WiFi joins through the
+  // connection manager, which already runs there.
+  sshTerminal->wifi_auto_connect();
+  boot_defer("persist", boot_load_persistent, sshTerminal);
+  boot_defer("profiles", boot_load_profiles, sshTerminal);
 
   // Setup keyboard callback
   instance.kb.setCallback(onKeyPress);
@@ -119,29 +241,20 @@ void setup() {
   } else {
     Serial.println("[DEBUG] Keyboard Init FAILED");
   }
+  boot_mark("keyboard");
 
-  // Initialize Display & LVGL
-  beginLvglHelper(instance);
-
-  // Initialize SSH Terminal
-  // Initialize SSH Terminal
-  sshTerminal = new SSHTerminal();
+  lvgl_lock();
   terminalScreen = sshTerminal->create_terminal_screen();
-  lv_obj_t *launcherScreen = sshTerminal->create_launcher_screen();
-
-  // Start with launcher screen
-  sshTerminal->show_launcher();
-
-  // Auto-connect to WiFi if credentials exist
-  sshTerminal->wifi_auto_connect();
+  lvgl_unlock();
+  boot_mark("terminal_ui");
 
   // Display startup message (will be visible when user enters terminal)
   sshTerminal->append_text("═══════════════════════════════════════\n");
   sshTerminal->append_text("AVERROES POCKET SSH v2.7 Elite Ultra\n");
   sshTerminal->append_text("Infinity Wireframe / BG-Sync Active\n");
   sshTerminal->append_text("------------------------------------\n");
-  sshTerminal->append_text("Mode: PLUG & PLAY (Handcoded Fallback)\n");
   sshTerminal->append_text("Tip: Use encoder to scroll history.\n");
+  sshTerminal->append_text("Long press: scroll back through output.\n");
   sshTerminal->update_status_bar();
 
   // Hardware interrupts for encoder
@@ -150,11 +263,75 @@ void setup() {
   pinMode(ROTARY_B, INPUT_PULLUP);
   pinMode(ROTARY_C, INPUT_PULLUP);
   attachInterrupt(ROTARY_A, encISR, CHANGE);
+  attachInterrupt(ROTARY_C, buttonISR, CHANGE);
   VOID_HAL::unlock();
 
+  loopTask = xTaskGetCurrentTaskHandle();
+  esp_register_freertos_idle_hook_for_cpu(kbIdleHook, xPortGetCoreID());
+  lastInputMs = millis();
+
+  boot_mark("setup_done");
   Serial.println("System Ready.");
 }
 
+#if LOOP_LIGHT_SLEEP
+// Wake on the opposite of a pin's current level. gpio_wakeup_enable takes
+// over the pin's interrupt type, so the caller restores it afterwards.
+static uint8_t sleepWakeOn(int pin) {
+  uint8_t type = GPIO.pin[pin].int_type;
+  gpio_wakeup_enable((gpio_num_t)pin, digitalRead(pin) ? GPIO_INTR_LOW_LEVEL
+                                                       : GPIO_INTR_HIGH_LEVEL);
+  return type;
+}
+
+static void sleepWakeOff(int pin, uint8_t type) {
+  gpio_wakeup_disable((gpio_num_t)pin);
+  GPIO.pin[pin].int_type = type;
+}
+
+// Light sleep until a key, the encoder, the button or the timer. Pending
+// pin interrupts fire on wake, so the keyboard driver and encISR see the
+// edge that woke the chip.
+static void lightSleep(uint32_t ms) {
+  uint8_t kb = sleepWakeOn(KB_INT);
+  uint8_t enc = sleepWakeOn(ROTARY_A);
+  uint8_t btn = sleepWakeOn(ROTARY_C);
+  esp_sleep_enable_gpio_wakeup();
+  esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000);
+  Serial.flush();
+  esp_light_sleep_start();
+  sleepWakeOff(ROTARY_C, btn);
+  sleepWakeOff(ROTARY_A, enc);
+  sleepWakeOff(KB_INT, kb);
+  if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO) {
+    encISR(); // Count the detent that woke us
+    markInput();
+  }
+}
+#endif
+
+// Block until woken or wait_ms passes
+static void loopWait(uint32_t wait_ms, uint32_t now, bool pressed) {
+  // Re-arm the keyboard watch only once KB_INT has gone high, so a line
+  // the driver leaves low cannot spin the loop
+  if (digitalRead(KB_INT))
+    kbArmed = true;
+#if LOOP_LIGHT_SLEEP
+  if (kbArmed && !pressed && now - lastInputMs >= LOOP_IDLE_SLEEP_MS &&
+      sshTerminal && sshTerminal->can_light_sleep()) {
+    lightSleep(LOOP_SLEEP_MAX_MS);
+    return;
+  }
+#endif
+  if (wait_ms)
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait_ms));
+}
+
+static void minWait(uint32_t *wait, uint32_t ms) {
+  if (ms < *wait)
+    *wait = ms;
+}
+
 void loop() {
   // System Loop (Keyboard, etc)
   VOID_HAL::loop();
@@ -164,6 +341,7 @@ void loop() {
   int delta = pos - lastEncPos;
   if (delta != 0 && sshTerminal) {
     lastEncPos = pos;
+    markInput();
 
     // Haptic feedback - use effect 1 (strong click) for snappiness
     VOID_HAL::vibrate(1);
@@ -177,6 +355,15 @@ void loop() {
       else
         lv_group_focus_prev(g);
       lvgl_unlock();
+    } else if (sshTerminal->in_scroll_mode()) {
+      lvgl_lock();
+      // Jump between search matches, or move through output history;
+      // clockwise goes back in time
+      if (sshTerminal->search_active())
+        sshTerminal->search_step(delta);
+      else
+        sshTerminal->scroll_history(delta * SCROLL_LINES_PER_DETENT);
+      lvgl_unlock();
     } else {
       lvgl_lock();
       // Navigate history in terminal - allow proportional scrolling
@@ -188,63 +375,85 @@ void loop() {
   // Handle encoder button with debounce and long press
   bool isPressed = !digitalRead(ROTARY_C);
   uint32_t now = millis();
-
-  if (isPressed != lastButtonState && (now - lastButtonTime) > 50) {
-    lastButtonTime = now;
-    lastButtonState = isPressed;
-
-    if (isPressed) {
-      buttonPressStart = now;
-      longPressHandled = false;
-      VOID_HAL::vibrate(1);
-    } else {
-      // Released
-      if (!longPressHandled && sshTerminal) {
-        lvgl_lock();
-        if (sshTerminal->is_in_launcher()) {
-          // Select current profile
-          lv_group_t *g = sshTerminal->get_launcher_group();
-          lv_obj_t *focused = lv_group_get_focused(g);
-          if (focused) {
-            const char *type = (const char *)lv_obj_get_user_data(focused);
-            // DO NOT call show_terminal() here anymore.
-            // The connection_task will handle it to ensure synchronization.
-            sshTerminal->connect_to_profile(type);
+  uint32_t wait = LOOP_MAX_WAIT_MS;
+
+  if (isPressed != lastButtonState) {
+    if (now - lastButtonTime > DEBOUNCE_MS) {
+      lastButtonTime = now;
+      lastButtonState = isPressed;
+      markInput();
+
+      if (isPressed) {
+        buttonPressStart = now;
+        longPressHandled = false;
+        VOID_HAL::vibrate(1);
+      } else {
+        // Released
+        if (!longPressHandled && sshTerminal) {
+          lvgl_lock();
+          if (sshTerminal->is_in_launcher()) {
+            // Select current profile
+            lv_group_t *g = sshTerminal->get_launcher_group();
+            lv_obj_t *focused = lv_group_get_focused(g);
+            if (focused) {
+              const char *type = (const char *)lv_obj_get_user_data(focused);
+              // Switches to the terminal and queues the connection; the
+              // connection manager reports progress there.
+              sshTerminal->connect_to_profile(type);
+            }
+          } else if (sshTerminal->in_scroll_mode()) {
+            sshTerminal->set_scroll_mode(false);
+          } else {
+            // Send Enter to terminal
+            sshTerminal->handle_key_input('\n');
           }
-        } else {
-          // Send Enter to terminal
-          sshTerminal->handle_key_input('\n');
+          lvgl_unlock();
+          VOID_HAL::vibrate(7);
         }
-        lvgl_unlock();
-        VOID_HAL::vibrate(7);
       }
+    } else {
+      // Still bouncing: look again once the window closes
+      minWait(&wait, DEBOUNCE_MS + 1 - (now - lastButtonTime));
     }
   }
 
   // Handle long press (only in terminal)
-  if (isPressed && !longPressHandled && !sshTerminal->is_in_launcher() &&
-      (now - buttonPressStart) > LONG_PRESS_MS) {
-    longPressHandled = true;
-    lvgl_lock();
-    sshTerminal->delete_current_history_entry();
-    lvgl_unlock();
-    VOID_HAL::vibrate(14);
+  if (isPressed && !longPressHandled && !sshTerminal->is_in_launcher()) {
+    if ((now - buttonPressStart) > LONG_PRESS_MS) {
+      longPressHandled = true;
+      lvgl_lock();
+      if (sshTerminal->is_browsing_history())
+        sshTerminal->delete_current_history_entry();
+      else
+        sshTerminal->set_scroll_mode(!sshTerminal->in_scroll_mode());
+      lvgl_unlock();
+      VOID_HAL::vibrate(14);
+    } else {
+      minWait(&wait, LONG_PRESS_MS + 1 - (now - buttonPressStart));
+    }
   }
 
-  // Update status bar periodically
+  // Update status bar periodically from the telemetry snapshot
   static uint32_t lastBattUpdate = 0;
-  if (now - lastBattUpdate > 5000 && sshTerminal) {
+  if (now - lastBattUpdate >= STATUS_UPDATE_MS && sshTerminal) {
     lastBattUpdate = now;
-    VOID_HAL::refreshPower();
     sshTerminal->update_status_bar();
   }
+  minWait(&wait, STATUS_UPDATE_MS - (now - lastBattUpdate));
 
-  // Process LVGL tasks with mutex protection
+  // Batched history/session records reach flash outside the LVGL lock
+  if (sshTerminal)
+    sshTerminal->persist_tick(now);
+
+  // Process LVGL tasks with mutex protection. Mailbox updates posted since
+  // the last pass are applied first, so they land in this frame.
   lvgl_lock();
-  lv_timer_handler();
+  if (sshTerminal)
+    sshTerminal->service_ui();
+  AnimScheduler::tick();
+  uint32_t next = lv_timer_handler(); // LV_NO_TIMER_READY when none
   lvgl_unlock();
+  minWait(&wait, next);
 
-  // Final cleanup loop call is redundant, removed to consolidate above.
-
-  delay(5);
+  loopWait(wait, now, isPressed);
 }
@@ -0,0 +1,34 @@
+/**
+ * Native (host) headless display
+ */
+
+#include "native_display.h"
+#include <Arduino.h>
+
+#define NATIVE_DRAW_LINES 40 // Same partial-buffer height as the device
+
+static NativeDisplayStats stats = {0, 0};
+
+static uint32_t native_tick() { return millis(); }
+
+static void native_flush_cb(lv_display_t *disp, const lv_area_t *area,
+                            uint8_t *px_map) {
+  stats.flushes++;
+  stats.pixels += (uint64_t)lv_area_get_width(area) * lv_area_get_height(area);
+  lv_display_flush_ready(disp);
+}
+
+lv_display_t *native_display_begin(int32_t width, int32_t height) {
+  lv_init();
+  lv_tick_set_cb(native_tick);
+
+  lv_display_t *disp = lv_display_create(width, height);
+  size_t buf_size = width * NATIVE_DRAW_LINES * sizeof(uint16_t);
+  void *buf = malloc(buf_size);
+  lv_display_set_buffers(disp, buf, NULL, buf_size,
+                         LV_DISPLAY_RENDER_MODE_PARTIAL);
+  lv_display_set_flush_cb(disp, native_flush_cb);
+  return disp;
+}
+
+NativeDisplayStats native_display_stats() { return stats; }
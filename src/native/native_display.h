@@ -0,0 +1,19 @@
+#ifndef NATIVE_DISPLAY_H
+#define NATIVE_DISPLAY_H
+
+#include <lvgl.h>
+
+/**
+ * Headless LVGL display for the native build. Rendering runs for real into
+ * a partial buffer; flush just counts pixels and completes immediately.
+ */
+
+struct NativeDisplayStats {
+  uint32_t flushes;
+  uint64_t pixels;
+};
+
+lv_display_t *native_display_begin(int32_t width, int32_t height);
+NativeDisplayStats native_display_stats();
+
+#endif // NATIVE_DISPLAY_H
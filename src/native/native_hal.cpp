@@ -0,0 +1,17 @@
+/**
+ * Native (host) globals normally provided by the board support package and
+ * main.cpp: the board instance behind VOID_HAL, Serial and the LVGL lock.
+ */
+
+#include <Arduino.h>
+#include <LilyGoLib.h>
+
+NativeSerial Serial;
+
+static LilyGoLoRaPager native_board;
+LilyGoLoRaPager &instance = native_board;
+
+static SemaphoreHandle_t lvgl_mutex = xSemaphoreCreateRecursiveMutex();
+
+void lvgl_lock() { xSemaphoreTakeRecursive(lvgl_mutex, portMAX_DELAY); }
+void lvgl_unlock() { xSemaphoreGiveRecursive(lvgl_mutex); }
@@ -0,0 +1,109 @@
+/**
+ * AVERROES native terminal driver
+ *
+ * Replays a captured PTY stream (file argument or stdin) through the same
+ * path the device uses: receive ring -> VT parser -> cell grid -> LVGL
+ * terminal view on a headless display, then prints the final screen.
+ *
+ *   .pio/build/native/program [-n] [capture.bin]
+ *     -n   treat LF as CRLF (plain text instead of PTY output)
+ *   .pio/build/native/program --bench [corpus]
+ *     run the TermBench corpora (all, or dmesg|ls|htop|vim|cat)
+ */
+
+#include "bench/TermBench.h"
+#include "native_display.h"
+#include "ssh/ByteRing.h"
+#include "ssh/TerminalView.h"
+#include "ssh/VTParser.h"
+#include <Arduino.h>
+
+#define NATIVE_WIDTH 480 // Pager panel, landscape
+#define NATIVE_HEIGHT 222
+#define NATIVE_RING_SIZE (64 * 1024)
+#define NATIVE_CHUNK 4096 // Matches the SSH receive task's read size
+
+static void drain(ByteRing &ring, VTParser &vt, TerminalView &view) {
+  const char *span;
+  size_t n;
+  while ((n = ring.read_span(&span)) > 0) {
+    vt.feed(span, n);
+    ring.consume(n);
+  }
+  view.sync();
+  lv_timer_handler();
+}
+
+#ifndef PIO_UNIT_TESTING // pio test links the suite's own main()
+int main(int argc, char **argv) {
+  bool lnm = false;
+  bool bench = false;
+  const char *path = nullptr;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-n"))
+      lnm = true;
+    else if (!strcmp(argv[i], "--bench"))
+      bench = true;
+    else
+      path = argv[i];
+  }
+
+  if (bench) {
+    native_display_begin(NATIVE_WIDTH, NATIVE_HEIGHT);
+    if (!path) {
+      term_bench_run(lv_screen_active(), &lv_font_montserrat_12);
+      return 0;
+    }
+    TermBenchResult r;
+    if (!term_bench_one(lv_screen_active(), &lv_font_montserrat_12, path, r)) {
+      fprintf(stderr, "unknown corpus %s\n", path);
+      return 1;
+    }
+    term_bench_print(r);
+    return 0;
+  }
+
+  FILE *in = path ? fopen(path, "rb") : stdin;
+  if (!in) {
+    fprintf(stderr, "cannot open %s\n", path);
+    return 1;
+  }
+
+  native_display_begin(NATIVE_WIDTH, NATIVE_HEIGHT);
+
+  VTParser vt;
+  TerminalView view;
+  view.create(lv_screen_active(), &vt.screen(), &lv_font_montserrat_12);
+  uint16_t cols = 80, rows = 24;
+  view.fit(cols, rows);
+  vt.screen().resize(cols, rows);
+  vt.screen().newline_mode = lnm;
+
+  ByteRing ring;
+  ring.begin(NATIVE_RING_SIZE);
+
+  char chunk[NATIVE_CHUNK];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), in)) > 0) {
+    size_t off = 0;
+    while (off < n) {
+      off += ring.write(chunk + off, n - off);
+      if (off < n)
+        drain(ring, vt, view); // Backpressure, like the receive task
+    }
+    drain(ring, vt, view);
+  }
+  if (in != stdin)
+    fclose(in);
+  lv_refr_now(NULL);
+
+  static char text[TERM_MAX_ROWS * (TERM_MAX_COLS * 4 + 1) + 1];
+  vt.screen().snapshot_text(text, sizeof(text));
+  fputs(text, stdout);
+
+  NativeDisplayStats ds = native_display_stats();
+  fprintf(stderr, "%ux%u grid, %u flushes, %llu px\n", cols, rows,
+          (unsigned)ds.flushes, (unsigned long long)ds.pixels);
+  return 0;
+}
+#endif // PIO_UNIT_TESTING
@@ -0,0 +1,111 @@
+#ifndef BYTE_RING_H
+#define BYTE_RING_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <esp_heap_caps.h>
+
+/**
+ * ByteRing
+ * Fixed-capacity single-producer/single-consumer byte ring. The SSH receive
+ * task is the only writer and the LVGL task the only reader; head and tail
+ * are free-running atomic indices, so no lock is needed. Storage lives in
+ * PSRAM when available.
+ *
+ * Overflow is never silent: bytes that do not fit are counted as dropped,
+ * and producers that wait for space instead (backpressure) record a stall.
+ */
+
+class ByteRing {
+public:
+  struct Stats {
+    uint32_t written;         // Bytes accepted
+    uint32_t dropped;         // Bytes rejected because the ring was full
+    uint32_t overflow_events; // write() calls that dropped anything
+    uint32_t stalls;          // Producer waits for space (backpressure)
+    uint32_t high_water;      // Peak fill level in bytes
+  };
+
+  ByteRing() {}
+  ~ByteRing() {
+    if (_buf)
+      heap_caps_free(_buf);
+  }
+
+  // Capacity is rounded down to a power of two
+  bool begin(size_t capacity) {
+    size_t cap = 1;
+    while (cap * 2 <= capacity)
+      cap *= 2;
+    _buf = (char *)heap_caps_malloc(cap, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!_buf)
+      _buf = (char *)heap_caps_malloc(cap, MALLOC_CAP_8BIT);
+    if (!_buf)
+      return false;
+    _mask = cap - 1;
+    return true;
+  }
+
+  size_t capacity() const { return _buf ? _mask + 1 : 0; }
+
+  size_t available() const {
+    return _head.load(std::memory_order_acquire) -
+           _tail.load(std::memory_order_acquire);
+  }
+
+  size_t free_space() const { return capacity() - available(); }
+
+  // Producer side
+  size_t write(const char *data, size_t len) {
+    if (!_buf)
+      return 0;
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    uint32_t tail = _tail.load(std::memory_order_acquire);
+    size_t room = capacity() - (head - tail);
+    size_t n = len < room ? len : room;
+
+    size_t off = head & _mask;
+    size_t first = n < capacity() - off ? n : capacity() - off;
+    memcpy(_buf + off, data, first);
+    memcpy(_buf, data + first, n - first);
+    _head.store(head + n, std::memory_order_release);
+
+    _stats.written += n;
+    if (n < len) {
+      _stats.dropped += len - n;
+      _stats.overflow_events++;
+    }
+    size_t fill = head + n - tail;
+    if (fill > _stats.high_water)
+      _stats.high_water = fill;
+    return n;
+  }
+
+  void note_stall() { _stats.stalls++; }
+
+  // Consumer side: contiguous readable span, then consume() what was used
+  size_t read_span(const char **ptr) const {
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    size_t avail = _head.load(std::memory_order_acquire) - tail;
+    size_t off = tail & _mask;
+    size_t to_end = capacity() - off;
+    *ptr = _buf + off;
+    return avail < to_end ? avail : to_end;
+  }
+
+  void consume(size_t n) {
+    _tail.store(_tail.load(std::memory_order_relaxed) + n,
+                std::memory_order_release);
+  }
+
+  Stats stats() const { return _stats; }
+
+private:
+  char *_buf = nullptr;
+  size_t _mask = 0;
+  std::atomic<uint32_t> _head = {0};
+  std::atomic<uint32_t> _tail = {0};
+  Stats _stats = {0, 0, 0, 0, 0}; // Written by the producer only
+};
+
+#endif // BYTE_RING_H
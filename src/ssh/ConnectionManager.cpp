@@ -0,0 +1,803 @@
+/**
+ * ConnectionManager - staged, non-blocking WiFi/NTP/WireGuard/SSH bring-up
+ */
+
+#include "ConnectionManager.h"
+#include "../boot/BootTrace.h"
+#include "ssh_terminal.h"
+#include <Preferences.h>
+#include <sys/select.h>
+#include <time.h>
+
+#define CONN_TASK_STACK (16 * 1024) // libssh key exchange runs here
+#define CONN_TASK_PRIORITY 5
+#define CONN_TASK_CORE 0 // With the WiFi stack, away from loop() and LVGL
+
+// Requests posted to the worker
+#define CMD_WIFI 0x01      // Join (new or saved credentials)
+#define CMD_WIFI_DROP 0x02 // Leave the network on purpose
+#define CMD_WIFI_LOST 0x04 // Link dropped under us
+#define CMD_SESSION 0x08   // Bring up a shell for _req_target
+#define CMD_CANCEL 0x10    // Abort the session request
+#define CMD_WAKE 0x20      // Re-step now (WiFi event)
+
+// With resume on, the shell runs inside a tmux (or screen) session that
+// survives a dropped link and is re-attached by the next connect
+#define SSH_RESUME_CMD                                                       \
+  "tmux new-session -A -s pager 2>/dev/null || "                            \
+  "screen -xRR -S pager 2>/dev/null || exec \"$SHELL\" -l"
+
+static ConnectionManager *conn_instance = nullptr;
+static Preferences conn_prefs;
+
+// Wrap-safe "has time at arrived"
+static bool due(uint32_t now, uint32_t at) { return (int32_t)(now - at) >= 0; }
+
+static void min_wait(uint32_t *wait, uint32_t ms) {
+  if (ms < *wait)
+    *wait = ms;
+}
+
+void ConnectionManager::begin(SSHTerminal *term) {
+  _t = term;
+  conn_instance = this;
+  // Retries and backoff are ours; the driver must not race them
+  WiFi.setAutoReconnect(false);
+  WiFi.onEvent(wifi_event_cb);
+}
+
+// ---- Requests ----
+
+void ConnectionManager::request_wifi(const char *ssid, const char *pass) {
+  portENTER_CRITICAL(&_mux);
+  _req_saved = ssid == nullptr;
+  if (ssid) {
+    strncpy(_req_ssid, ssid, sizeof(_req_ssid) - 1);
+    strncpy(_req_pass, pass ? pass : "", sizeof(_req_pass) - 1);
+  }
+  portEXIT_CRITICAL(&_mux);
+  post(CMD_WIFI);
+}
+
+void ConnectionManager::drop_wifi() { post(CMD_WIFI_DROP); }
+
+bool ConnectionManager::request_session(const ConnTarget &target) {
+  portENTER_CRITICAL(&_mux);
+  bool busy = _session_wanted || (_cmd & CMD_SESSION);
+  if (!busy)
+    _req_target = target;
+  portEXIT_CRITICAL(&_mux);
+  if (busy)
+    return false;
+  post(CMD_SESSION);
+  return true;
+}
+
+void ConnectionManager::cancel() { post(CMD_CANCEL); }
+
+void ConnectionManager::post(uint32_t cmd) {
+  portENTER_CRITICAL(&_mux);
+  _cmd |= cmd;
+  bool spawn = !_running;
+  _running = true;
+  portEXIT_CRITICAL(&_mux);
+
+  if (!spawn) {
+    if (_task)
+      xTaskNotifyGive(_task);
+    return;
+  }
+  if (xTaskCreatePinnedToCore(task_entry, "conn", CONN_TASK_STACK, this,
+                              CONN_TASK_PRIORITY, &_task,
+                              CONN_TASK_CORE) != pdPASS) {
+    portENTER_CRITICAL(&_mux);
+    _running = false;
+    portEXIT_CRITICAL(&_mux);
+    _t->append_text("[ERROR] Connection task failed to start.\n");
+  }
+}
+
+void ConnectionManager::wifi_event_cb(arduino_event_id_t event,
+                                      arduino_event_info_t info) {
+  ConnectionManager *m = conn_instance;
+  if (!m)
+    return;
+  if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+    if (m->_stage[CONN_WIFI].state == STAGE_RUNNING)
+      m->post(CMD_WAKE);
+  } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+    if (m->_stage[CONN_WIFI].state == STAGE_DONE)
+      m->post(CMD_WIFI_LOST);
+  }
+}
+
+// ---- Worker ----
+
+void ConnectionManager::task_entry(void *param) {
+  ((ConnectionManager *)param)->run();
+  vTaskDelete(NULL);
+}
+
+void ConnectionManager::run() {
+  for (;;) {
+    take_commands(millis());
+    uint32_t wait = step(millis());
+
+    if (wait == UINT32_MAX) {
+      // Nothing in flight: exit unless a request raced in
+      portENTER_CRITICAL(&_mux);
+      bool idle = _cmd == 0;
+      if (idle) {
+        _running = false;
+        _task = nullptr;
+      }
+      portEXIT_CRITICAL(&_mux);
+      if (idle)
+        return;
+      continue;
+    }
+
+    // During the SSH handshake wake on socket input rather than a timer
+    socket_t fd = _session ? ssh_get_fd(_session) : SSH_INVALID_SOCKET;
+    if (fd != SSH_INVALID_SOCKET) {
+      uint32_t ms = wait < CONN_SSH_POLL_MS ? wait : CONN_SSH_POLL_MS;
+      fd_set rfds;
+      FD_ZERO(&rfds);
+      FD_SET(fd, &rfds);
+      struct timeval tv;
+      tv.tv_sec = 0;
+      tv.tv_usec = ms * 1000;
+      select(fd + 1, &rfds, NULL, NULL, &tv);
+      ulTaskNotifyTake(pdTRUE, 0);
+    } else {
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait));
+    }
+  }
+}
+
+void ConnectionManager::take_commands(uint32_t now) {
+  portENTER_CRITICAL(&_mux);
+  uint32_t cmd = _cmd;
+  _cmd = 0;
+  bool use_saved = _req_saved;
+  if ((cmd & CMD_WIFI) && !use_saved) {
+    memcpy(_ssid, _req_ssid, sizeof(_ssid));
+    memcpy(_pass, _req_pass, sizeof(_pass));
+  }
+  if (cmd & CMD_SESSION)
+    _target = _req_target;
+  portEXIT_CRITICAL(&_mux);
+
+  Stage &wifi = _stage[CONN_WIFI];
+
+  if (cmd & CMD_CANCEL) {
+    if (wifi.state == STAGE_RUNNING || wifi.state == STAGE_BACKOFF) {
+      WiFi.disconnect();
+      wifi.state = STAGE_IDLE;
+      _link_wanted = false;
+    }
+    if (_session_wanted)
+      end_session("[CANCELLED] Connection aborted.");
+  }
+
+  if (cmd & CMD_WIFI_DROP) {
+    _link_wanted = false;
+    if (_session_wanted)
+      end_session("[ERROR] Link Offline.");
+    WiFi.disconnect(true);
+    wifi.state = STAGE_IDLE;
+    _t->wifi_connected = false;
+    _t->update_status_bar();
+  }
+
+  if ((cmd & CMD_WIFI_LOST) && wifi.state == STAGE_DONE) {
+    _t->wifi_connected = false;
+    _t->update_status_bar();
+    _t->append_text("[WARN] WiFi link lost.\n");
+    wifi.state = STAGE_IDLE;
+    if (_link_wanted) {
+      wifi.attempts = 0;
+      fail(CONN_WIFI, now, "Rejoining WiFi", true);
+    }
+  }
+
+  if (cmd & CMD_WIFI) {
+    if (use_saved)
+      _ssid[0] = '\0'; // Loaded in start_wifi
+    _link_wanted = true;
+    wifi.attempts = 0;
+    start_wifi(now);
+  }
+
+  if (cmd & CMD_SESSION) {
+    _session_wanted = true;
+    _t->is_connecting = true;
+    _t->update_status_bar();
+    // Finished stages are reused; failed ones get a fresh set of attempts
+    for (int s = 0; s < CONN_STAGES; s++) {
+      if (_stage[s].state == STAGE_FAILED)
+        _stage[s].state = STAGE_IDLE;
+      _stage[s].attempts = 0;
+    }
+    _stage[CONN_SSH].state = STAGE_IDLE;
+    _no_pins = false;
+    _req_ms = now;
+    _req_warm = wifi.state == STAGE_DONE &&
+                (!_target.tunnel || _stage[CONN_WG].state == STAGE_DONE);
+  }
+}
+
+uint32_t ConnectionManager::step(uint32_t now) {
+  uint32_t wait = UINT32_MAX;
+  step_wifi(now, &wait);
+  step_ntp(now, &wait);
+
+  if (!_session_wanted)
+    return wait;
+
+  Stage &wifi = _stage[CONN_WIFI];
+  if (wifi.state == STAGE_IDLE) {
+    _link_wanted = true;
+    _ssid[0] = '\0';
+    start_wifi(now);
+    min_wait(&wait, CONN_TICK_MS);
+    return wait;
+  }
+  if (wifi.state == STAGE_FAILED) {
+    end_session("[ERROR] Link Offline. Check WiFi.");
+    return wait;
+  }
+  if (wifi.state != STAGE_DONE)
+    return wait; // Joining or backing off
+
+  // The tunnel comes up while NTP is still syncing
+  if (_target.tunnel) {
+    Stage &wg = _stage[CONN_WG];
+    if (wg.state == STAGE_IDLE)
+      start_wg(now);
+    step_wg(now, &wait);
+    if (wg.state == STAGE_FAILED) {
+      end_session("[ERROR] Tunnel Failure. Aborting.");
+      return wait;
+    }
+    if (wg.state != STAGE_DONE)
+      return wait;
+  }
+
+  Stage &ssh = _stage[CONN_SSH];
+  if (ssh.state == STAGE_IDLE)
+    start_ssh(now);
+  step_ssh(now, &wait);
+  if (ssh.state == STAGE_FAILED)
+    end_session("[ERROR] SSH Negotiation Failed.");
+  else if (ssh.state == STAGE_DONE)
+    end_session(nullptr);
+  return wait;
+}
+
+// ---- Stage bookkeeping ----
+
+void ConnectionManager::start(ConnStage s, uint32_t now, uint32_t timeout_ms) {
+  _stage[s].state = STAGE_RUNNING;
+  _stage[s].started_ms = now;
+  _stage[s].deadline_ms = now + timeout_ms;
+}
+
+void ConnectionManager::done(ConnStage s, uint32_t now) {
+  _stage[s].state = STAGE_DONE;
+  _stage[s].took_ms = now - _stage[s].started_ms;
+  _stage[s].attempts = 0;
+}
+
+void ConnectionManager::fail(ConnStage s, uint32_t now, const char *why,
+                             bool retry) {
+  Stage &st = _stage[s];
+  st.attempts++;
+  char line[96];
+  if (retry && st.attempts < CONN_MAX_ATTEMPTS) {
+    uint32_t backoff = CONN_BACKOFF_BASE_MS << (st.attempts - 1);
+    if (backoff > CONN_BACKOFF_MAX_MS)
+      backoff = CONN_BACKOFF_MAX_MS;
+    st.state = STAGE_BACKOFF;
+    st.retry_ms = now + backoff;
+    snprintf(line, sizeof(line), "[WARN] %s, retry %u/%u in %u s\n", why,
+             (unsigned)st.attempts, (unsigned)(CONN_MAX_ATTEMPTS - 1),
+             (unsigned)(backoff / 1000));
+  } else {
+    st.state = STAGE_FAILED;
+    snprintf(line, sizeof(line), "[FAILED] %s\n", why);
+  }
+  _t->append_text(line);
+}
+
+// True while a BACKOFF stage still has to wait
+bool ConnectionManager::waiting(ConnStage s, uint32_t now, uint32_t *wait) {
+  Stage &st = _stage[s];
+  if (st.state != STAGE_BACKOFF)
+    return false;
+  if (due(now, st.retry_ms))
+    return false;
+  min_wait(wait, st.retry_ms - now);
+  return true;
+}
+
+int ConnectionManager::format_timing(char *out, size_t max) const {
+  static const char *const names[CONN_STAGES] = {"WiFi", "NTP", "WG", "SSH"};
+  int len = snprintf(out, max, "Connect");
+  for (int s = 0; s < CONN_STAGES && len > 0 && len < (int)max; s++)
+    len += snprintf(out + len, max - len, " %s %u", names[s],
+                    (unsigned)_stage[s].took_ms);
+  if (len > 0 && len < (int)max)
+    len += snprintf(out + len, max - len, " ms; shell cold %u warm %u ms",
+                    (unsigned)_cold_ms, (unsigned)_warm_ms);
+  return len;
+}
+
+int ConnectionManager::format_crypto(char *out, size_t max) const {
+  return snprintf(out, max, "Crypto kex %u auth %u ms, %s%s",
+                  (unsigned)_kex_ms, (unsigned)_auth_ms,
+                  _cipher[0] ? _cipher : "-",
+                  strncmp(_cipher, "aes", 3) == 0 ? " (AES unit)" : "");
+}
+
+// A session is warm when the link (and tunnel) were already up and the
+// host's algorithms came from the cache
+void ConnectionManager::report_shell_time(uint32_t now) {
+  uint32_t took = now - _req_ms;
+  bool warm = _req_warm && _pinned;
+  if (warm)
+    _warm_ms = took;
+  else
+    _cold_ms = took;
+  char line[80];
+  snprintf(line, sizeof(line), "[TIMING] Shell in %u ms (%s link, %s host)\n",
+           (unsigned)took, _req_warm ? "warm" : "cold",
+           _pinned ? "cached" : "new");
+  _t->append_text(line);
+}
+
+// ---- WiFi and NTP ----
+
+void ConnectionManager::start_wifi(uint32_t now) {
+  if (!_ssid[0]) {
+    conn_prefs.begin("wifi", true);
+    String ssid = conn_prefs.getString("ssid", "");
+    String pass = conn_prefs.getString("pass", "");
+    conn_prefs.end();
+    if (ssid != "") {
+      strncpy(_ssid, ssid.c_str(), sizeof(_ssid) - 1);
+      strncpy(_pass, pass.c_str(), sizeof(_pass) - 1);
+    } else {
+      _t->append_text("No WiFi saved. Join one with: connect <SSID> <PASS>\n");
+      fail(CONN_WIFI, now, "WiFi not configured", false);
+      return;
+    }
+  }
+
+  _t->append_text("Connecting to WiFi: ");
+  _t->append_text(_ssid);
+  _t->append_text("\n");
+  WiFi.mode(WIFI_STA);
+  WiFi.begin(_ssid, _pass);
+  start(CONN_WIFI, now, WIFI_JOIN_TIMEOUT_MS);
+}
+
+void ConnectionManager::step_wifi(uint32_t now, uint32_t *wait) {
+  Stage &st = _stage[CONN_WIFI];
+  if (st.state == STAGE_BACKOFF && !waiting(CONN_WIFI, now, wait))
+    start_wifi(now);
+  if (st.state != STAGE_RUNNING)
+    return;
+
+  if (WiFi.status() != WL_CONNECTED) {
+    if (due(now, st.deadline_ms)) {
+      WiFi.disconnect();
+      fail(CONN_WIFI, now, "WiFi join timed out", true);
+      if (st.state == STAGE_BACKOFF)
+        min_wait(wait, st.retry_ms - now);
+    } else {
+      min_wait(wait, CONN_TICK_MS);
+    }
+    return;
+  }
+
+  done(CONN_WIFI, now);
+  boot_mark("wifi_up");
+  _t->wifi_connected = true;
+  char line[80];
+  snprintf(line, sizeof(line), "WiFi connected! IP: %s (%u ms)\n",
+           WiFi.localIP().toString().c_str(), (unsigned)st.took_ms);
+  _t->append_text(line);
+  _t->update_status_bar();
+
+  // Save WiFi credentials for auto-connect
+  conn_prefs.begin("wifi", false);
+  if (conn_prefs.getString("ssid", "") != _ssid ||
+      conn_prefs.getString("pass", "") != _pass) {
+    conn_prefs.putString("ssid", _ssid);
+    conn_prefs.putString("pass", _pass);
+  }
+  conn_prefs.end();
+
+  // Runs in parallel with the tunnel and the SSH handshake
+  if (_stage[CONN_NTP].state != STAGE_DONE) {
+    _t->append_text("Synchronizing Time (NTP)...\n");
+    configTime(0, 0, "pool.ntp.org", "time.nist.gov");
+    start(CONN_NTP, now, NTP_SYNC_TIMEOUT_MS);
+    min_wait(wait, CONN_TICK_MS);
+  }
+}
+
+void ConnectionManager::step_ntp(uint32_t now, uint32_t *wait) {
+  Stage &st = _stage[CONN_NTP];
+  if (st.state != STAGE_RUNNING)
+    return;
+  if (time(nullptr) > 10000) {
+    done(CONN_NTP, now);
+    char line[48];
+    snprintf(line, sizeof(line), "Time Synced (%u ms).\n",
+             (unsigned)st.took_ms);
+    _t->append_text(line);
+  } else if (due(now, st.deadline_ms)) {
+    fail(CONN_NTP, now, "Time Sync Failed (Handshake may fail)", false);
+  } else {
+    min_wait(wait, CONN_TICK_MS);
+  }
+}
+
+// ---- WireGuard ----
+
+void ConnectionManager::start_wg(uint32_t now) {
+  start(CONN_WG, now, WG_HANDSHAKE_TIMEOUT_MS);
+  if (_t->wg.is_initialized()) {
+    done(CONN_WG, now); // Still up from an earlier session
+    return;
+  }
+
+  WireGuardConfig config;
+  if (!_t->load_wg_config(config)) {
+    _t->append_text("Set the tunnel up with: save wg <priv> <pub> "
+                    "<end:port> <ip>\n");
+    fail(CONN_WG, now, "WireGuard not configured", false);
+    return;
+  }
+  IPAddress local_ip;
+  if (!local_ip.fromString(config.local_ip.c_str())) {
+    fail(CONN_WG, now, "Invalid WireGuard Local IP", false);
+    return;
+  }
+
+  _t->append_text("Establishing WireGuard Tunnel (MTU 1420)...\n");
+  if (!_t->wg.begin(local_ip, config.private_key.c_str(),
+                    config.endpoint.c_str(), config.remote_public_key.c_str(),
+                    config.port))
+    fail(CONN_WG, now, "WireGuard initialization failed", true);
+}
+
+void ConnectionManager::step_wg(uint32_t now, uint32_t *wait) {
+  Stage &st = _stage[CONN_WG];
+  if (st.state == STAGE_BACKOFF && !waiting(CONN_WG, now, wait))
+    start_wg(now);
+  if (st.state != STAGE_RUNNING)
+    return;
+
+  if (_t->wg.is_initialized()) {
+    done(CONN_WG, now);
+    char line[64];
+    snprintf(line, sizeof(line), "[SUCCESS] WireGuard Tunnel active (%u ms).\n",
+             (unsigned)st.took_ms);
+    _t->append_text(line);
+  } else if (due(now, st.deadline_ms)) {
+    _t->wg.end();
+    fail(CONN_WG, now, "Handshake timeout", true);
+  } else {
+    min_wait(wait, CONN_TICK_MS);
+  }
+}
+
+// ---- SSH ----
+
+void ConnectionManager::start_ssh(uint32_t now) {
+  start(CONN_SSH, now, SSH_CONNECT_TIMEOUT_MS);
+  char line[96];
+  snprintf(line, sizeof(line), "Connecting to SSH: %s:%d\n", _target.host,
+           _target.port);
+  _t->append_text(line);
+
+  _session = ssh_new();
+  if (!_session) {
+    fail(CONN_SSH, now, "Failed to create SSH session", false);
+    return;
+  }
+  int port = _target.port;
+  long timeout_sec = 10;
+  ssh_options_set(_session, SSH_OPTIONS_HOST, _target.host);
+  ssh_options_set(_session, SSH_OPTIONS_PORT, &port);
+  ssh_options_set(_session, SSH_OPTIONS_USER, _target.user);
+  ssh_options_set(_session, SSH_OPTIONS_TIMEOUT, &timeout_sec);
+
+#if SSH_HW_CRYPTO
+  prefer_hw_crypto();
+#endif
+  _host_known = HostCache::load(_target.host, _target.port, _host);
+  _pinned = false;
+  if (_host_known && !_no_pins)
+    pin_algorithms();
+
+  // Every libssh call below returns SSH_AGAIN instead of waiting
+  ssh_set_blocking(_session, 0);
+  _ssh_step = SSH_KEX;
+  _key_tried = false;
+}
+
+// Offer only what this host negotiated last time. The client's first
+// choice wins anyway; pinning keeps the KEXINIT small and stops a
+// preference change from landing on a slower exchange. Names libssh does
+// not know are rejected by ssh_options_set and leave its defaults in place.
+void ConnectionManager::pin_algorithms() {
+  if (_host.kex[0])
+    ssh_options_set(_session, SSH_OPTIONS_KEY_EXCHANGE, _host.kex);
+  if (_host.hostkey[0])
+    ssh_options_set(_session, SSH_OPTIONS_HOSTKEYS, _host.hostkey);
+#if !SSH_HW_CRYPTO
+  // With SSH_HW_CRYPTO the preference list picks these instead, so a
+  // cipher cached before the option was set cannot stick
+  if (_host.cipher[0]) {
+    ssh_options_set(_session, SSH_OPTIONS_CIPHERS_C_S, _host.cipher);
+    ssh_options_set(_session, SSH_OPTIONS_CIPHERS_S_C, _host.cipher);
+  }
+  if (_host.hmac[0]) {
+    ssh_options_set(_session, SSH_OPTIONS_HMAC_C_S, _host.hmac);
+    ssh_options_set(_session, SSH_OPTIONS_HMAC_S_C, _host.hmac);
+  }
+#endif
+  _pinned = true;
+}
+
+#if SSH_HW_CRYPTO
+// Ciphers and MACs the S3's AES and SHA units run go first. libssh's
+// mbedTLS backend reaches them through the SDK's MBEDTLS_HARDWARE_AES/SHA
+// ports; ChaCha20 stays last, for servers that offer nothing else. Key
+// exchange keeps libssh's order (curve25519 first): the S3 has no ECC unit.
+void ConnectionManager::prefer_hw_crypto() {
+  ssh_options_set(_session, SSH_OPTIONS_CIPHERS_C_S, SSH_HW_CIPHERS);
+  ssh_options_set(_session, SSH_OPTIONS_CIPHERS_S_C, SSH_HW_CIPHERS);
+  ssh_options_set(_session, SSH_OPTIONS_HMAC_C_S, SSH_HW_HMACS);
+  ssh_options_set(_session, SSH_OPTIONS_HMAC_S_C, SSH_HW_HMACS);
+}
+#endif
+
+// Trust-on-first-use: a new host key is cached, a changed one aborts the
+// request. Also refreshes the cached algorithms. False if the stage failed.
+bool ConnectionManager::check_host_key(uint32_t now) {
+  ssh_key key = nullptr;
+  unsigned char *hash = nullptr;
+  size_t hash_len = 0;
+  if (ssh_get_server_publickey(_session, &key) != SSH_OK ||
+      ssh_get_publickey_hash(key, SSH_PUBLICKEY_HASH_SHA256, &hash,
+                             &hash_len) != 0 ||
+      hash_len > HOST_CACHE_FP_LEN) {
+    ssh_key_free(key);
+    ssh_clean_pubkey_hash(&hash);
+    close_ssh();
+    fail(CONN_SSH, now, "Could not read the host key", false);
+    return false;
+  }
+  enum ssh_keytypes_e type = ssh_key_type(key);
+  ssh_key_free(key);
+
+  if (_host_known && (hash_len != _host.fingerprint_len ||
+                      memcmp(hash, _host.fingerprint, hash_len) != 0)) {
+    ssh_clean_pubkey_hash(&hash);
+    _t->append_text("[SECURITY] Host key changed since the last login. "
+                    "If expected, type 'forget' and retry.\n");
+    close_ssh();
+    fail(CONN_SSH, now, "Host key mismatch", false);
+    return false;
+  }
+  if (!_host_known) {
+    char *fp =
+        ssh_get_fingerprint_hash(SSH_PUBLICKEY_HASH_SHA256, hash, hash_len);
+    if (fp) {
+      _t->append_text("[TOFU] New host key ");
+      _t->append_text(fp);
+      _t->append_text("\n");
+      ssh_string_free_char(fp);
+    }
+  }
+
+  HostRecord rec = {};
+  const char *kex = ssh_get_kex_algo(_session);
+  const char *cipher = ssh_get_cipher_out(_session);
+  const char *hmac = ssh_get_hmac_out(_session);
+  if (kex)
+    strncpy(rec.kex, kex, HOST_CACHE_ALGO_LEN - 1);
+  // An RSA key signs with rsa-sha2-*, not the SHA-1 "ssh-rsa" type name
+  const char *key_algo = type == SSH_KEYTYPE_RSA ? "rsa-sha2-512,rsa-sha2-256"
+                                                 : ssh_key_type_to_char(type);
+  if (key_algo)
+    strncpy(rec.hostkey, key_algo, HOST_CACHE_ALGO_LEN - 1);
+  if (cipher) {
+    strncpy(rec.cipher, cipher, HOST_CACHE_ALGO_LEN - 1);
+    strcpy(_cipher, rec.cipher);
+  }
+  if (hmac && strncmp(hmac, "aead-", 5) != 0)
+    strncpy(rec.hmac, hmac, HOST_CACHE_ALGO_LEN - 1);
+  memcpy(rec.fingerprint, hash, hash_len);
+  rec.fingerprint_len = hash_len;
+  ssh_clean_pubkey_hash(&hash);
+
+  if (!_host_known || memcmp(&rec, &_host, sizeof(rec)) != 0)
+    HostCache::save(_target.host, _target.port, rec);
+  _host = rec;
+  _host_known = true;
+  return true;
+}
+
+// Push the handshake as far as the socket allows. SSH_OK means the step
+// finished, SSH_AGAIN that it waits for the server, SSH_ERROR that the
+// stage has been failed.
+int ConnectionManager::advance_ssh(uint32_t now) {
+  int rc;
+  switch (_ssh_step) {
+  case SSH_KEX:
+    rc = ssh_connect(_session);
+    if (rc == SSH_AGAIN)
+      return rc;
+    if (rc != SSH_OK) {
+      _t->append_text("SSH connection failed: ");
+      _t->append_text(ssh_get_error(_session));
+      _t->append_text("\n");
+
+      // Help the user diagnose
+      if (strncmp(_target.host, "100.", 4) == 0) {
+        _t->append_text("Tip: Tailscale IPs (100.x.x.x) only work if this "
+                        "WiFi has a Tailscale Subnet Router.\n");
+      } else if (strncmp(_target.host, "192.168.", 8) == 0) {
+        _t->append_text("Tip: Check if your local machine (192.168.x.x) is "
+                        "on the same WiFi.\n");
+      }
+      close_ssh();
+      // The server may have dropped an algorithm: next try offers them all
+      if (_pinned)
+        _no_pins = true;
+      fail(CONN_SSH, now, "SSH connection failed", true);
+      return SSH_ERROR;
+    }
+    _kex_done_ms = now;
+    _kex_ms = now - _stage[CONN_SSH].started_ms;
+    if (!check_host_key(now))
+      return SSH_ERROR;
+    _ssh_step = SSH_AUTH;
+    return SSH_OK;
+
+  case SSH_AUTH:
+    // The device key first: one signature, no password round trip. The
+    // parsed key is shared by every connect.
+    rc = SSH_AUTH_DENIED;
+    if (!_key_tried) {
+      ssh_key key = _t->keys.key();
+      if (key)
+        rc = ssh_userauth_publickey(_session, nullptr, key);
+      if (rc == SSH_AUTH_AGAIN)
+        return SSH_AGAIN;
+      _key_tried = true;
+    }
+    if (rc != SSH_AUTH_SUCCESS && _target.pass[0])
+      rc = ssh_userauth_password(_session, nullptr, _target.pass);
+    if (rc == SSH_AUTH_AGAIN)
+      return SSH_AGAIN;
+    if (rc != SSH_AUTH_SUCCESS) {
+      close_ssh();
+      fail(CONN_SSH, now, "SSH authentication failed!", false);
+      return SSH_ERROR;
+    }
+    _auth_ms = now - _kex_done_ms;
+    _ssh_step = SSH_CHANNEL;
+    return SSH_OK;
+
+  case SSH_CHANNEL:
+    if (!_channel)
+      _channel = ssh_channel_new(_session);
+    rc = _channel ? ssh_channel_open_session(_channel) : SSH_ERROR;
+    if (rc == SSH_AGAIN)
+      return rc;
+    if (rc != SSH_OK) {
+      close_ssh();
+      fail(CONN_SSH, now, "Failed to open channel!", true);
+      return SSH_ERROR;
+    }
+    // Request a PTY matching the on-screen cell grid
+    lvgl_lock();
+    _t->prepare_pty();
+    lvgl_unlock();
+    _ssh_step = SSH_PTY;
+    return SSH_OK;
+
+  case SSH_PTY:
+    rc = ssh_channel_request_pty_size(_channel, "xterm-256color",
+                                      _t->term_cols, _t->term_rows);
+    if (rc == SSH_AGAIN)
+      return rc;
+    if (rc != SSH_OK)
+      _t->append_text("Failed to request PTY!\n");
+    _ssh_step = SSH_SHELL;
+    return SSH_OK;
+
+  case SSH_SHELL:
+    if (_t->resume_enabled())
+      rc = ssh_channel_request_exec(_channel, SSH_RESUME_CMD);
+    else
+      rc = ssh_channel_request_shell(_channel);
+    if (rc == SSH_AGAIN)
+      return rc;
+    if (rc != SSH_OK) {
+      close_ssh();
+      fail(CONN_SSH, now, "Failed to start shell!", true);
+      return SSH_ERROR;
+    }
+    // The receive task and writers expect a blocking session
+    ssh_set_blocking(_session, 1);
+    done(CONN_SSH, now);
+    report_shell_time(now);
+    _t->on_shell_ready(_session, _channel, _target);
+    _session = nullptr;
+    _channel = nullptr;
+    return SSH_ERROR; // Nothing left to advance
+  }
+  return SSH_ERROR;
+}
+
+void ConnectionManager::step_ssh(uint32_t now, uint32_t *wait) {
+  Stage &st = _stage[CONN_SSH];
+  if (st.state == STAGE_BACKOFF && !waiting(CONN_SSH, now, wait))
+    start_ssh(now);
+  if (st.state != STAGE_RUNNING)
+    return;
+
+  if (due(now, st.deadline_ms)) {
+    close_ssh();
+    fail(CONN_SSH, now, "SSH handshake timed out", true);
+    return;
+  }
+
+  int rc;
+  while ((rc = advance_ssh(now)) == SSH_OK) {
+  }
+  if (rc == SSH_AGAIN)
+    min_wait(wait, CONN_TICK_MS);
+  else if (st.state == STAGE_BACKOFF)
+    min_wait(wait, st.retry_ms - now);
+}
+
+void ConnectionManager::close_ssh() {
+  if (_channel) {
+    ssh_channel_free(_channel);
+    _channel = nullptr;
+  }
+  if (_session) {
+    ssh_disconnect(_session);
+    ssh_free(_session);
+    _session = nullptr;
+  }
+}
+
+void ConnectionManager::end_session(const char *error) {
+  close_ssh();
+  if (error) {
+    _t->append_text(error);
+    _t->append_text("\n");
+  }
+  _session_wanted = false;
+  _t->is_connecting = false;
+
+  // A tunnel that never came up is torn down; a working one stays warm
+  Stage &wg = _stage[CONN_WG];
+  if (wg.state == STAGE_RUNNING || wg.state == STAGE_BACKOFF) {
+    _t->wg.end();
+    wg.state = STAGE_IDLE;
+  }
+  if (_stage[CONN_SSH].state != STAGE_DONE)
+    _stage[CONN_SSH].state = STAGE_IDLE;
+  _t->update_status_bar();
+}
@@ -0,0 +1,191 @@
+#ifndef CONNECTION_MANAGER_H
+#define CONNECTION_MANAGER_H
+
+#include "HostCache.h"
+#include <Arduino.h>
+#include <WiFi.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <libssh/libssh.h>
+
+/**
+ * ConnectionManager
+ * Event-driven bring-up of WiFi, NTP, WireGuard and the SSH shell. Each
+ * stage is a small state machine with a deadline and a retry backoff; the
+ * worker task steps them whenever a WiFi event, a socket or a timer needs
+ * attention, and never blocks for longer than one poll.
+ *
+ * NTP runs alongside WireGuard and SSH instead of in front of them. libssh
+ * is driven in non-blocking mode, so a cancel() lands between handshake
+ * messages. The worker exists only while something is in flight; requests
+ * from any task start it on demand.
+ *
+ * Reconnects are cheap: WiFi and a working tunnel stay up after a session
+ * ends, and a host seen before is offered only the algorithms it chose last
+ * time (see HostCache), with its host key checked against the cached one.
+ */
+
+#define CONN_TICK_MS 100          // Stage poll period while anything runs
+#define CONN_SSH_POLL_MS 20       // Socket wait while the handshake runs
+#define CONN_MAX_ATTEMPTS 3       // Per stage, before a request fails
+#define CONN_BACKOFF_BASE_MS 1000 // Doubles per failed attempt
+#define CONN_BACKOFF_MAX_MS 16000
+#define WIFI_JOIN_TIMEOUT_MS 15000
+#define NTP_SYNC_TIMEOUT_MS 7500
+#define WG_HANDSHAKE_TIMEOUT_MS 5000
+#define SSH_CONNECT_TIMEOUT_MS 20000
+
+// Prefer algorithms with hardware support on the S3 (AES-GCM/CTR, SHA-2
+// MACs) over ChaCha20-Poly1305. -DSSH_HW_CRYPTO=0 keeps libssh's order.
+#ifndef SSH_HW_CRYPTO
+#define SSH_HW_CRYPTO 1
+#endif
+#define SSH_HW_CIPHERS                                                       \
+  "aes128-gcm@openssh.com,aes128-ctr,aes256-gcm@openssh.com,aes256-ctr,"    \
+  "chacha20-poly1305@openssh.com"
+#define SSH_HW_HMACS                                                         \
+  "hmac-sha2-256-etm@openssh.com,hmac-sha2-256,hmac-sha1-etm@openssh.com,"  \
+  "hmac-sha1"
+
+class SSHTerminal;
+
+enum ConnStage : uint8_t {
+  CONN_WIFI = 0,
+  CONN_NTP,
+  CONN_WG,
+  CONN_SSH,
+  CONN_STAGES
+};
+
+enum ConnStageState : uint8_t {
+  STAGE_IDLE = 0,
+  STAGE_RUNNING,
+  STAGE_BACKOFF, // Waiting to retry
+  STAGE_DONE,
+  STAGE_FAILED
+};
+
+struct ConnTarget {
+  char host[64];
+  char user[32];
+  char pass[64];
+  int port;
+  bool tunnel; // Bring up WireGuard first
+};
+
+class ConnectionManager {
+public:
+  void begin(SSHTerminal *term);
+
+  // ---- Requests (any task, never block) ----
+
+  // Join a network; nullptr uses the saved (or default) credentials
+  void request_wifi(const char *ssid, const char *pass);
+  // Stop using WiFi and leave the network
+  void drop_wifi();
+  // Bring up whatever the target needs, then open a shell. Returns false
+  // if a session request is already in flight.
+  bool request_session(const ConnTarget &target);
+  // Abort the in-flight session request; finished stages stay up
+  void cancel();
+
+  bool busy() const { return _session_wanted; }
+  ConnStageState state(ConnStage s) const { return _stage[s].state; }
+  // "WiFi 3120 NTP 410 WG 880 SSH 2390 ms" from the last successful runs,
+  // then request-to-shell time of the last cold and warm session
+  int format_timing(char *out, size_t max) const;
+  // "Crypto kex 840 auth 120 ms, aes128-gcm@openssh.com (AES unit)" for
+  // the last handshake
+  int format_crypto(char *out, size_t max) const;
+
+private:
+  struct Stage {
+    volatile ConnStageState state;
+    uint8_t attempts;
+    uint32_t started_ms;
+    uint32_t deadline_ms;
+    uint32_t retry_ms; // BACKOFF: when to start again
+    uint32_t took_ms;  // Last successful run
+  };
+
+  enum SSHStep : uint8_t {
+    SSH_KEX = 0,
+    SSH_AUTH,
+    SSH_CHANNEL,
+    SSH_PTY,
+    SSH_SHELL
+  };
+
+  SSHTerminal *_t = nullptr;
+  Stage _stage[CONN_STAGES] = {};
+
+  // Posted by requesters under _mux, consumed by the worker
+  portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+  uint32_t _cmd = 0;
+  bool _running = false; // Worker task exists
+  char _req_ssid[33] = {0};
+  char _req_pass[65] = {0};
+  bool _req_saved = true; // Use stored credentials
+  ConnTarget _req_target = {};
+  TaskHandle_t _task = nullptr;
+
+  // Worker state
+  volatile bool _session_wanted = false;
+  bool _link_wanted = false; // Rejoin after an unexpected drop
+  char _ssid[33] = {0};
+  char _pass[65] = {0};
+  ConnTarget _target = {};
+  SSHStep _ssh_step = SSH_KEX;
+  ssh_session _session = nullptr;
+  ssh_channel _channel = nullptr;
+  bool _key_tried = false; // Public key offered; password next
+
+  // Host cache for the current target
+  HostRecord _host = {};
+  bool _host_known = false;
+  bool _pinned = false;  // Only the cached algorithms were offered
+  bool _no_pins = false; // A pinned handshake failed: negotiate in full
+
+  // Request-to-shell timing
+  uint32_t _req_ms = 0;
+  bool _req_warm = false; // Link and tunnel were up at request time
+  uint32_t _cold_ms = 0;  // Last shell over a cold link or to a new host
+  uint32_t _warm_ms = 0;  // Last shell over a warm link to a cached host
+
+  // Last handshake
+  uint32_t _kex_done_ms = 0;
+  uint32_t _kex_ms = 0;  // TCP connect and key exchange
+  uint32_t _auth_ms = 0; // User authentication
+  char _cipher[HOST_CACHE_ALGO_LEN] = {0};
+
+  void post(uint32_t cmd);
+  static void task_entry(void *param);
+  static void wifi_event_cb(arduino_event_id_t event,
+                            arduino_event_info_t info);
+  void run();
+  void take_commands(uint32_t now);
+  uint32_t step(uint32_t now); // ms until the next step, UINT32_MAX = idle
+
+  void start(ConnStage s, uint32_t now, uint32_t timeout_ms);
+  void done(ConnStage s, uint32_t now);
+  // Retry with backoff, or give up after CONN_MAX_ATTEMPTS
+  void fail(ConnStage s, uint32_t now, const char *why, bool retry);
+  bool waiting(ConnStage s, uint32_t now, uint32_t *wait);
+
+  void start_wifi(uint32_t now);
+  void step_wifi(uint32_t now, uint32_t *wait);
+  void step_ntp(uint32_t now, uint32_t *wait);
+  void start_wg(uint32_t now);
+  void step_wg(uint32_t now, uint32_t *wait);
+  void start_ssh(uint32_t now);
+  void prefer_hw_crypto();
+  void pin_algorithms();
+  bool check_host_key(uint32_t now);
+  int advance_ssh(uint32_t now);
+  void report_shell_time(uint32_t now);
+  void step_ssh(uint32_t now, uint32_t *wait);
+  void close_ssh();
+  void end_session(const char *error);
+};
+
+#endif // CONNECTION_MANAGER_H
@@ -0,0 +1,99 @@
+/**
+ * GlyphAtlas - per-colour RGB565 glyph tiles for the terminal view
+ */
+
+#include "GlyphAtlas.h"
+#include <esp_heap_caps.h>
+
+GlyphAtlas::GlyphAtlas(const TermFont &font) : _font(font) {}
+
+GlyphAtlas::~GlyphAtlas() {
+  heap_caps_free(_tiles);
+  heap_caps_free(_keys);
+  heap_caps_free(_glyph);
+}
+
+int GlyphAtlas::index(uint16_t cp) const {
+  // Printable ASCII sits at the front of the table in order
+  if (cp >= 0x20 && cp < 0x7F)
+    return cp - 0x20;
+  int lo = 0x7F - 0x20;
+  int hi = _font.count - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    if (_font.codepoints[mid] == cp)
+      return mid;
+    if (_font.codepoints[mid] < cp)
+      lo = mid + 1;
+    else
+      hi = mid - 1;
+  }
+  return -1;
+}
+
+bool GlyphAtlas::alloc() {
+  if (_tiles || _failed)
+    return _tiles != nullptr;
+  size_t tile_bytes = (size_t)_font.w * _font.h * sizeof(uint16_t);
+  _tiles = (uint16_t *)heap_caps_malloc(GLYPH_ATLAS_SLOTS * tile_bytes,
+                                        MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!_tiles)
+    _tiles = (uint16_t *)heap_caps_malloc(GLYPH_ATLAS_SLOTS * tile_bytes,
+                                          MALLOC_CAP_8BIT);
+  // Tags are checked on every cell: internal RAM
+  _keys = (uint32_t *)heap_caps_malloc(GLYPH_ATLAS_SLOTS * sizeof(uint32_t),
+                                       MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  _glyph = (uint16_t *)heap_caps_calloc(GLYPH_ATLAS_SLOTS, sizeof(uint16_t),
+                                        MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  if (!_tiles || !_keys || !_glyph) {
+    heap_caps_free(_tiles);
+    heap_caps_free(_keys);
+    heap_caps_free(_glyph);
+    _tiles = nullptr;
+    _keys = nullptr;
+    _glyph = nullptr;
+    _failed = true;
+    return false;
+  }
+  return true;
+}
+
+const uint16_t *GlyphAtlas::tile(int idx, uint16_t fg, uint16_t bg) {
+  if (idx < 0 || idx >= _font.count || !alloc())
+    return nullptr;
+  uint32_t key = (uint32_t)fg << 16 | bg;
+  uint32_t slot = (key * 2654435761u + idx * 40503u) >> 16;
+  slot &= GLYPH_ATLAS_SLOTS - 1;
+  uint16_t *out = _tiles + slot * _font.w * _font.h;
+  if (_glyph[slot] == idx + 1 && _keys[slot] == key) {
+    _stats.hits++;
+    return out;
+  }
+  expand(idx, fg, bg, out);
+  _glyph[slot] = idx + 1;
+  _keys[slot] = key;
+  _stats.misses++;
+  return out;
+}
+
+void GlyphAtlas::expand(int idx, uint16_t fg, uint16_t bg,
+                        uint16_t *out) const {
+  // The 16 coverage levels between bg and fg, blended once per tile
+  int fr = fg >> 11, fgr = (fg >> 5) & 0x3F, fb = fg & 0x1F;
+  int br = bg >> 11, bgr = (bg >> 5) & 0x3F, bb = bg & 0x1F;
+  uint16_t ramp[16];
+  for (int a = 0; a < 16; a++) {
+    int r = br + (fr - br) * a / 15;
+    int g = bgr + (fgr - bgr) * a / 15;
+    int b = bb + (fb - bb) * a / 15;
+    ramp[a] = (uint16_t)(r << 11 | g << 5 | b);
+  }
+
+  const uint8_t *cov = _font.coverage + (size_t)idx * TERM_FONT_GLYPH_BYTES;
+  int pixels = _font.w * _font.h;
+  for (int i = 0; i < pixels; i += 2) {
+    uint8_t pair = *cov++;
+    out[i] = ramp[pair >> 4];
+    out[i + 1] = ramp[pair & 0x0F];
+  }
+}
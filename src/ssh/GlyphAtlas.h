@@ -0,0 +1,56 @@
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include "TermFont.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * GlyphAtlas
+ * RGB565 tiles of TermFont glyphs, expanded on first use for each
+ * (glyph, fg, bg) combination and kept in a direct-mapped cache in PSRAM.
+ * A terminal screen uses few colour pairs, so after the first frame every
+ * cell is a straight copy of a finished tile: no coverage decoding and no
+ * blending per pixel.
+ *
+ * Not thread-safe; used from the LVGL draw callback only.
+ */
+
+#ifndef GLYPH_ATLAS_SLOTS
+#define GLYPH_ATLAS_SLOTS 256 // Cached tiles, power of two (144 B each)
+#endif
+
+struct GlyphAtlasStats {
+  uint32_t hits;
+  uint32_t misses; // Tiles expanded
+};
+
+class GlyphAtlas {
+public:
+  explicit GlyphAtlas(const TermFont &font = term_font_6x12);
+  ~GlyphAtlas();
+
+  uint8_t cell_w() const { return _font.w; }
+  uint8_t cell_h() const { return _font.h; }
+
+  // Font index of a code point, -1 if the font has no such glyph
+  int index(uint16_t cp) const;
+  // Tile for glyph index idx, w * h pixels row by row; nullptr if there is
+  // no memory for the cache
+  const uint16_t *tile(int idx, uint16_t fg, uint16_t bg);
+
+  GlyphAtlasStats stats() const { return _stats; }
+
+private:
+  const TermFont &_font;
+  uint16_t *_tiles = nullptr;
+  uint32_t *_keys = nullptr; // fg << 16 | bg per slot
+  uint16_t *_glyph = nullptr; // Glyph index + 1 per slot, 0 = empty
+  bool _failed = false;
+  GlyphAtlasStats _stats = {0, 0};
+
+  bool alloc();
+  void expand(int idx, uint16_t fg, uint16_t bg, uint16_t *out) const;
+};
+
+#endif // GLYPH_ATLAS_H
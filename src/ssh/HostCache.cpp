@@ -0,0 +1,59 @@
+/**
+ * HostCache - negotiated algorithms and host key fingerprints in NVS
+ */
+
+#include "HostCache.h"
+#include <Preferences.h>
+#include <stdio.h>
+#include <string.h>
+
+#define HOST_CACHE_NS "sshhosts"
+
+// NVS keys are at most 15 characters: hash host:port into "h" + 8 hex
+static void host_key(const char *host, int port, char *out, size_t max) {
+  uint32_t h = 2166136261u; // FNV-1a
+  for (const char *p = host; *p; p++)
+    h = (h ^ (uint8_t)*p) * 16777619u;
+  h = (h ^ (uint8_t)':') * 16777619u;
+  h = (h ^ (uint32_t)(port & 0xFFFF)) * 16777619u;
+  snprintf(out, max, "h%08x", (unsigned)h);
+}
+
+bool HostCache::load(const char *host, int port, HostRecord &rec) {
+  char key[16];
+  host_key(host, port, key, sizeof(key));
+  Preferences prefs;
+  if (!prefs.begin(HOST_CACHE_NS, true))
+    return false;
+  bool ok = prefs.getBytesLength(key) == sizeof(HostRecord) &&
+            prefs.getBytes(key, &rec, sizeof(HostRecord)) == sizeof(HostRecord);
+  prefs.end();
+  if (!ok)
+    return false;
+
+  // Never trust stored strings to be terminated
+  rec.kex[HOST_CACHE_ALGO_LEN - 1] = '\0';
+  rec.hostkey[HOST_CACHE_ALGO_LEN - 1] = '\0';
+  rec.cipher[HOST_CACHE_ALGO_LEN - 1] = '\0';
+  rec.hmac[HOST_CACHE_ALGO_LEN - 1] = '\0';
+  return rec.fingerprint_len <= HOST_CACHE_FP_LEN;
+}
+
+bool HostCache::save(const char *host, int port, const HostRecord &rec) {
+  char key[16];
+  host_key(host, port, key, sizeof(key));
+  Preferences prefs;
+  if (!prefs.begin(HOST_CACHE_NS, false))
+    return false;
+  bool ok = prefs.putBytes(key, &rec, sizeof(HostRecord)) == sizeof(HostRecord);
+  prefs.end();
+  return ok;
+}
+
+void HostCache::forget_all() {
+  Preferences prefs;
+  if (!prefs.begin(HOST_CACHE_NS, false))
+    return;
+  prefs.clear();
+  prefs.end();
+}
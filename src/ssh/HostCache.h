@@ -0,0 +1,34 @@
+#ifndef HOST_CACHE_H
+#define HOST_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * HostCache
+ * What the last handshake with a host settled on: key exchange, host key
+ * algorithm, cipher and MAC, plus the SHA-256 fingerprint of the host key.
+ * Kept in NVS per host:port, so a reconnect offers only the algorithms that
+ * worked last time and the host key is checked trust-on-first-use.
+ * Each call opens its own NVS handle; safe from any task.
+ */
+
+#define HOST_CACHE_ALGO_LEN 48
+#define HOST_CACHE_FP_LEN 32 // SHA-256
+
+struct HostRecord {
+  char kex[HOST_CACHE_ALGO_LEN];
+  char hostkey[HOST_CACHE_ALGO_LEN];
+  char cipher[HOST_CACHE_ALGO_LEN];
+  char hmac[HOST_CACHE_ALGO_LEN]; // Empty for AEAD ciphers
+  uint8_t fingerprint[HOST_CACHE_FP_LEN];
+  uint8_t fingerprint_len;
+};
+
+namespace HostCache {
+bool load(const char *host, int port, HostRecord &rec);
+bool save(const char *host, int port, const HostRecord &rec);
+void forget_all();
+} // namespace HostCache
+
+#endif // HOST_CACHE_H
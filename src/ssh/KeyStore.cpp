@@ -0,0 +1,326 @@
+/**
+ * KeyStore - SSH identity sealed in NVS, parsed once
+ */
+
+#include "KeyStore.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <esp_efuse.h>
+#include <esp_heap_caps.h>
+#include <esp_system.h>
+#include <mbedtls/gcm.h>
+#include <mbedtls/md.h>
+#include <mbedtls/platform_util.h>
+#include <soc/soc_caps.h>
+#include <string.h>
+
+#if SOC_HMAC_SUPPORTED || CONFIG_IDF_TARGET_ESP32S3
+#include "esp_hmac.h"
+#define KEYSTORE_HAVE_HMAC 1
+#endif
+
+#define KEYSTORE_NS "keystore"
+#define KEYSTORE_ENTRY "id"
+#define KEYSTORE_LABEL "averroes-keystore-v1" // Sealing key derivation input
+#define KEYSTORE_MAX_FILE 4096
+
+// Sealed record: version, mode, IV, GCM tag, then the ciphertext of the
+// OpenSSH private key text. Version and mode are authenticated as well.
+#define SEAL_VERSION 1
+#define SEAL_MODE_CHIP 0  // Key derived from the chip MAC
+#define SEAL_MODE_EFUSE 1 // Key from the HMAC peripheral and an eFuse key
+#define SEAL_IV_LEN 12
+#define SEAL_TAG_LEN 16
+#define SEAL_HEADER (2 + SEAL_IV_LEN + SEAL_TAG_LEN)
+
+// HMAC(eFuse key, label); the eFuse key itself is unreadable by software
+static bool efuse_seal_key(uint8_t out[32]) {
+#ifdef KEYSTORE_HAVE_HMAC
+  esp_efuse_block_t block;
+  if (!esp_efuse_find_purpose(ESP_EFUSE_KEY_PURPOSE_HMAC_UP, &block))
+    return false;
+  hmac_key_id_t id = (hmac_key_id_t)(HMAC_KEY0 + (block - EFUSE_BLK_KEY0));
+  return esp_hmac_calculate(id, KEYSTORE_LABEL, strlen(KEYSTORE_LABEL),
+                            out) == ESP_OK;
+#else
+  (void)out;
+  return false;
+#endif
+}
+
+static bool chip_seal_key(uint8_t out[32]) {
+  uint8_t mac[6];
+  if (esp_efuse_mac_get_default(mac) != ESP_OK)
+    return false;
+  return mbedtls_md_hmac(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), mac,
+                         sizeof(mac), (const uint8_t *)KEYSTORE_LABEL,
+                         strlen(KEYSTORE_LABEL), out) == 0;
+}
+
+static bool seal_key(uint8_t mode, uint8_t out[32]) {
+  return mode == SEAL_MODE_EFUSE ? efuse_seal_key(out) : chip_seal_key(out);
+}
+
+static uint8_t *alloc_buf(size_t len) {
+  // Internal RAM: the plaintext key should not linger in PSRAM
+  return (uint8_t *)heap_caps_malloc(len, MALLOC_CAP_INTERNAL |
+                                              MALLOC_CAP_8BIT);
+}
+
+// Release a buffer that held key material
+static void wipe_free(void *p, size_t len) {
+  if (!p)
+    return;
+  mbedtls_platform_zeroize(p, len);
+  heap_caps_free(p);
+}
+
+// Encrypt text into a new record; *hw reports the eFuse key sealed it
+static uint8_t *seal(const char *text, size_t *rec_len, bool *hw) {
+  uint8_t key[32];
+  uint8_t mode = SEAL_MODE_EFUSE;
+  if (!efuse_seal_key(key)) {
+    mode = SEAL_MODE_CHIP;
+    if (!chip_seal_key(key))
+      return nullptr;
+  }
+
+  size_t len = strlen(text);
+  uint8_t *rec = alloc_buf(SEAL_HEADER + len);
+  if (!rec) {
+    mbedtls_platform_zeroize(key, sizeof(key));
+    return nullptr;
+  }
+  rec[0] = SEAL_VERSION;
+  rec[1] = mode;
+  esp_fill_random(rec + 2, SEAL_IV_LEN);
+
+  mbedtls_gcm_context gcm;
+  mbedtls_gcm_init(&gcm);
+  int rc = mbedtls_gcm_setkey(&gcm, MBEDTLS_CIPHER_ID_AES, key, 256);
+  if (rc == 0)
+    rc = mbedtls_gcm_crypt_and_tag(
+        &gcm, MBEDTLS_GCM_ENCRYPT, len, rec + 2, SEAL_IV_LEN, rec, 2,
+        (const uint8_t *)text, rec + SEAL_HEADER, SEAL_TAG_LEN,
+        rec + 2 + SEAL_IV_LEN);
+  mbedtls_gcm_free(&gcm);
+  mbedtls_platform_zeroize(key, sizeof(key));
+  if (rc != 0) {
+    heap_caps_free(rec);
+    return nullptr;
+  }
+  *rec_len = SEAL_HEADER + len;
+  *hw = mode == SEAL_MODE_EFUSE;
+  return rec;
+}
+
+// Decrypt a record into a new NUL-terminated string (free with wipe_free)
+static char *unseal(const uint8_t *rec, size_t rec_len, bool *hw) {
+  if (rec_len <= SEAL_HEADER || rec[0] != SEAL_VERSION)
+    return nullptr;
+  uint8_t key[32];
+  if (!seal_key(rec[1], key))
+    return nullptr;
+
+  size_t len = rec_len - SEAL_HEADER;
+  char *text = (char *)alloc_buf(len + 1);
+  if (!text) {
+    mbedtls_platform_zeroize(key, sizeof(key));
+    return nullptr;
+  }
+  mbedtls_gcm_context gcm;
+  mbedtls_gcm_init(&gcm);
+  int rc = mbedtls_gcm_setkey(&gcm, MBEDTLS_CIPHER_ID_AES, key, 256);
+  if (rc == 0)
+    rc = mbedtls_gcm_auth_decrypt(&gcm, len, rec + 2, SEAL_IV_LEN, rec, 2,
+                                  rec + 2 + SEAL_IV_LEN, SEAL_TAG_LEN,
+                                  rec + SEAL_HEADER, (uint8_t *)text);
+  mbedtls_gcm_free(&gcm);
+  mbedtls_platform_zeroize(key, sizeof(key));
+  if (rc != 0) {
+    wipe_free(text, len + 1);
+    return nullptr;
+  }
+  text[len] = '\0';
+  *hw = rec[1] == SEAL_MODE_EFUSE;
+  return text;
+}
+
+KeyStore::KeyStore() { _mutex = xSemaphoreCreateMutex(); }
+
+KeyStore::~KeyStore() {
+  ssh_key_free(_key);
+  vSemaphoreDelete(_mutex);
+}
+
+bool KeyStore::load() {
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+  if (!_loaded) {
+    _loaded = true;
+    Preferences prefs;
+    size_t len = 0;
+    uint8_t *rec = nullptr;
+    if (prefs.begin(KEYSTORE_NS, true)) {
+      len = prefs.getBytesLength(KEYSTORE_ENTRY);
+      rec = len ? alloc_buf(len) : nullptr;
+      if (rec && prefs.getBytes(KEYSTORE_ENTRY, rec, len) != len)
+        len = 0;
+      prefs.end();
+    }
+
+    bool hw = false;
+    char *text = rec && len ? unseal(rec, len, &hw) : nullptr;
+    ssh_key key = nullptr;
+    if (text &&
+        ssh_pki_import_privkey_base64(text, nullptr, nullptr, nullptr,
+                                      &key) == SSH_OK)
+      adopt(key, hw);
+    else if (rec && len)
+      Serial.println("[KEYS] Stored key could not be unsealed");
+    if (text)
+      wipe_free(text, strlen(text) + 1);
+    heap_caps_free(rec);
+  }
+  bool ok = _key != nullptr;
+  xSemaphoreGive(_mutex);
+  return ok;
+}
+
+ssh_key KeyStore::key() {
+  load();
+  return _key;
+}
+
+bool KeyStore::hardware_bound() {
+  load();
+  return _hw;
+}
+
+void KeyStore::adopt(ssh_key key, bool hw) {
+  ssh_key_free(_key);
+  _key = key;
+  _hw = hw;
+}
+
+bool KeyStore::store(ssh_key key) {
+  char *text = nullptr;
+  if (ssh_pki_export_privkey_base64(key, nullptr, nullptr, nullptr, &text) !=
+      SSH_OK)
+    return false;
+  size_t rec_len = 0;
+  bool hw = false;
+  uint8_t *rec = seal(text, &rec_len, &hw);
+  mbedtls_platform_zeroize(text, strlen(text));
+  ssh_string_free_char(text);
+  if (!rec)
+    return false;
+
+  Preferences prefs;
+  bool ok = prefs.begin(KEYSTORE_NS, false) &&
+            prefs.putBytes(KEYSTORE_ENTRY, rec, rec_len) == rec_len;
+  prefs.end();
+  heap_caps_free(rec);
+  if (!ok)
+    return false;
+
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+  adopt(key, hw);
+  _loaded = true;
+  xSemaphoreGive(_mutex);
+  return true;
+}
+
+bool KeyStore::generate() {
+  ssh_key key = nullptr;
+  if (ssh_pki_generate(SSH_KEYTYPE_ED25519, 0, &key) != SSH_OK)
+    return false;
+  if (!store(key)) {
+    ssh_key_free(key);
+    return false;
+  }
+  return true;
+}
+
+bool KeyStore::import_file(fs::FS &fs, const char *path) {
+  File f = fs.open(path, FILE_READ);
+  if (!f)
+    return false;
+  size_t len = f.size();
+  char *text = len && len < KEYSTORE_MAX_FILE ? (char *)alloc_buf(len + 1)
+                                              : nullptr;
+  bool ok = text && f.read((uint8_t *)text, len) == len;
+  f.close();
+  if (!ok) {
+    wipe_free(text, len + 1);
+    return false;
+  }
+  text[len] = '\0';
+
+  ssh_key key = nullptr;
+  ok = ssh_pki_import_privkey_base64(text, nullptr, nullptr, nullptr,
+                                     &key) == SSH_OK &&
+       ssh_key_is_private(key);
+  wipe_free(text, len + 1);
+  if (ok)
+    ok = store(key);
+  if (!ok) {
+    ssh_key_free(key);
+    return false;
+  }
+  // The sealed copy is the only one left on the device
+  fs.remove(path);
+  return true;
+}
+
+void KeyStore::erase() {
+  Preferences prefs;
+  if (prefs.begin(KEYSTORE_NS, false)) {
+    prefs.clear();
+    prefs.end();
+  }
+  xSemaphoreTake(_mutex, portMAX_DELAY);
+  adopt(nullptr, false);
+  _loaded = true;
+  xSemaphoreGive(_mutex);
+}
+
+bool KeyStore::public_line(char *out, size_t max) {
+  ssh_key k = key();
+  char *b64 = nullptr;
+  if (!k || ssh_pki_export_pubkey_base64(k, &b64) != SSH_OK)
+    return false;
+  const char *type = ssh_key_type_to_char(ssh_key_type(k));
+  int n = snprintf(out, max, "%s %s %s", type ? type : "ssh-ed25519", b64,
+                   KEYSTORE_COMMENT);
+  ssh_string_free_char(b64);
+  return n > 0 && (size_t)n < max;
+}
+
+bool KeyStore::put_secret(Preferences &prefs, const char *key,
+                          const char *text) {
+  size_t rec_len = 0;
+  bool hw = false;
+  uint8_t *rec = text && *text ? seal(text, &rec_len, &hw) : nullptr;
+  if (!rec)
+    return false;
+  bool ok = prefs.putBytes(key, rec, rec_len) == rec_len;
+  heap_caps_free(rec);
+  return ok;
+}
+
+bool KeyStore::get_secret(Preferences &prefs, const char *key,
+                          std::string &out) {
+  size_t len = prefs.getBytesLength(key);
+  uint8_t *rec = len ? alloc_buf(len) : nullptr;
+  if (!rec)
+    return false;
+  bool hw = false;
+  char *text = prefs.getBytes(key, rec, len) == len ? unseal(rec, len, &hw)
+                                                     : nullptr;
+  heap_caps_free(rec);
+  if (!text)
+    return false;
+  out = text;
+  wipe_free(text, strlen(text) + 1);
+  return true;
+}
@@ -0,0 +1,74 @@
+#ifndef KEY_STORE_H
+#define KEY_STORE_H
+
+#include <FS.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <libssh/libssh.h>
+#include <stddef.h>
+#include <string>
+
+class Preferences;
+
+/**
+ * KeyStore
+ * The device's SSH identity: one private key (Ed25519 when generated on
+ * the device, any type libssh reads when imported from a provisioning
+ * file), sealed with AES-256-GCM in NVS.
+ *
+ * The sealing key never sits in flash. If an eFuse key block is burned with
+ * the HMAC_UP purpose, it is HMAC(eFuse key, label) computed by the HMAC
+ * peripheral, so a flash dump alone cannot unseal the identity. Without
+ * one it falls back to a key derived from the chip MAC, which only binds
+ * the blob to this chip.
+ *
+ * The key is unsealed and parsed once (a boot job) and the parsed ssh_key
+ * is handed to every connect. Thread-safe; replacing the key while a
+ * connect is using it is the caller's to avoid. Profile passwords are
+ * sealed the same way (put_secret/get_secret).
+ */
+
+#define KEYSTORE_IMPORT_PATH "/id_ed25519" // FFat, removed once sealed
+#define KEYSTORE_COMMENT "averroes-pager"
+
+class KeyStore {
+public:
+  KeyStore();
+  ~KeyStore();
+
+  // Unseal and parse the stored key; later calls return the cached result
+  bool load();
+  // Parsed key, or nullptr if there is none (loads on first use)
+  ssh_key key();
+  // True if the stored key is sealed by the eFuse HMAC key
+  bool hardware_bound();
+
+  // New Ed25519 key; replaces the stored one
+  bool generate();
+  // OpenSSH or PEM private key file (unencrypted); the file is removed
+  // once the key is sealed
+  bool import_file(fs::FS &fs, const char *path);
+  void erase();
+
+  // "ssh-ed25519 AAAA... averroes-pager" for authorized_keys
+  bool public_line(char *out, size_t max);
+
+  // Short secrets (profile passwords) sealed the same way, as one bytes
+  // entry of an open Preferences namespace. text must not be empty.
+  static bool put_secret(Preferences &prefs, const char *key,
+                         const char *text);
+  // False if the entry is missing or does not unseal on this chip
+  static bool get_secret(Preferences &prefs, const char *key,
+                         std::string &out);
+
+private:
+  SemaphoreHandle_t _mutex;
+  ssh_key _key = nullptr;
+  bool _loaded = false;
+  bool _hw = false; // _key was sealed with the eFuse HMAC key
+
+  bool store(ssh_key key); // Seal, write, then adopt key
+  void adopt(ssh_key key, bool hw);
+};
+
+#endif // KEY_STORE_H
@@ -0,0 +1,57 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * LatencyHistogram
+ * Fixed power-of-two bucket histogram for microsecond latencies. Bucket i
+ * counts samples below 2^i ms (bucket 0: < 1 ms), the last bucket collects
+ * everything slower. Recording is a few integer ops, no allocation.
+ */
+
+#define LATENCY_BUCKETS 9 // <1 <2 <4 <8 <16 <32 <64 <128 >=128 ms
+
+class LatencyHistogram {
+public:
+  void record(uint32_t us) {
+    uint32_t ms = us / 1000;
+    int b = 0;
+    while (b < LATENCY_BUCKETS - 1 && ms >= (1u << b))
+      b++;
+    _buckets[b]++;
+    _count++;
+    _sum_us += us;
+    if (us > _max_us)
+      _max_us = us;
+    if (_count == 1 || us < _min_us)
+      _min_us = us;
+  }
+
+  void reset() { *this = LatencyHistogram(); }
+
+  uint32_t count() const { return _count; }
+  uint32_t min_us() const { return _min_us; }
+  uint32_t max_us() const { return _max_us; }
+  uint32_t avg_us() const { return _count ? _sum_us / _count : 0; }
+  uint32_t bucket(int i) const { return _buckets[i]; }
+
+  // One-line summary, e.g. "n=42 avg 6.1 max 19.3 ms | 0 3 20 15 4 0 0 0 0"
+  int format(char *out, size_t max) const {
+    int len = snprintf(out, max, "n=%u avg %.1f max %.1f ms |",
+                       (unsigned)_count, avg_us() / 1000.0, _max_us / 1000.0);
+    for (int i = 0; i < LATENCY_BUCKETS && len > 0 && len < (int)max; i++)
+      len += snprintf(out + len, max - len, " %u", (unsigned)_buckets[i]);
+    return len;
+  }
+
+private:
+  uint32_t _buckets[LATENCY_BUCKETS] = {0};
+  uint32_t _count = 0;
+  uint64_t _sum_us = 0;
+  uint32_t _min_us = 0;
+  uint32_t _max_us = 0;
+};
+
+#endif // LATENCY_HISTOGRAM_H
@@ -0,0 +1,74 @@
+#ifndef LINE_EDITOR_H
+#define LINE_EDITOR_H
+
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * LineEditor
+ * Fixed-capacity, NUL-terminated input line with a cursor. Every edit works
+ * in place, so typing never touches the heap. Input past capacity is
+ * ignored rather than reallocating.
+ */
+
+#ifndef LINE_EDITOR_MAX
+#define LINE_EDITOR_MAX 240
+#endif
+
+class LineEditor {
+public:
+  LineEditor() { clear(); }
+
+  const char *c_str() const { return _buf; }
+  size_t length() const { return _len; }
+  size_t cursor() const { return _cursor; }
+  bool empty() const { return _len == 0; }
+  bool full() const { return _len >= LINE_EDITOR_MAX; }
+
+  bool insert(char c) {
+    if (full())
+      return false;
+    memmove(_buf + _cursor + 1, _buf + _cursor, _len - _cursor + 1);
+    _buf[_cursor++] = c;
+    _len++;
+    return true;
+  }
+
+  bool backspace() {
+    if (_cursor == 0)
+      return false;
+    memmove(_buf + _cursor - 1, _buf + _cursor, _len - _cursor + 1);
+    _cursor--;
+    _len--;
+    return true;
+  }
+
+  void clear() {
+    _buf[0] = '\0';
+    _len = 0;
+    _cursor = 0;
+  }
+
+  // Replace the line (truncated to capacity), cursor at the end
+  void set(const char *text) {
+    size_t n = strlen(text);
+    if (n > LINE_EDITOR_MAX)
+      n = LINE_EDITOR_MAX;
+    memcpy(_buf, text, n);
+    _buf[n] = '\0';
+    _len = n;
+    _cursor = n;
+  }
+
+  bool equals(const char *s) const { return strcmp(_buf, s) == 0; }
+  bool starts_with(const char *prefix) const {
+    return strncmp(_buf, prefix, strlen(prefix)) == 0;
+  }
+
+private:
+  char _buf[LINE_EDITOR_MAX + 1];
+  size_t _len;
+  size_t _cursor;
+};
+
+#endif // LINE_EDITOR_H
@@ -0,0 +1,228 @@
+/**
+ * LogStore - append-only record log with batched writes and compaction
+ */
+
+#include "LogStore.h"
+#include <esp_heap_caps.h>
+#include <stdio.h>
+#include <string.h>
+
+#define LOG_MAGIC "AVL1"
+#define LOG_MAGIC_LEN 4
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len) {
+  crc = ~crc;
+  while (len--) {
+    crc ^= *data++;
+    for (int k = 0; k < 8; k++)
+      crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+  }
+  return ~crc;
+}
+
+static void encode_header(uint8_t *h, uint8_t type, const char *data,
+                          size_t len) {
+  h[0] = type;
+  h[1] = len & 0xFF;
+  h[2] = len >> 8;
+  uint32_t crc = crc32_update(0, h, 3);
+  crc = crc32_update(crc, (const uint8_t *)data, len);
+  h[3] = crc & 0xFF;
+  h[4] = (crc >> 8) & 0xFF;
+  h[5] = (crc >> 16) & 0xFF;
+  h[6] = crc >> 24;
+}
+
+LogStore::~LogStore() { heap_caps_free(_batch); }
+
+bool LogStore::begin(fs::FS &fs, const char *path) {
+  if (strlen(path) >= sizeof(_path))
+    return false;
+  if (!_batch) {
+    _batch = (char *)heap_caps_malloc(LOG_BATCH_BYTES,
+                                      MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!_batch)
+      _batch = (char *)heap_caps_malloc(LOG_BATCH_BYTES, MALLOC_CAP_8BIT);
+    if (!_batch)
+      return false;
+  }
+  _fs = &fs;
+  strcpy(_path, path);
+  snprintf(_tmp_path, sizeof(_tmp_path), "%s.new", path);
+  _target = _path;
+  _batch_len = 0;
+
+  // A reset between the two steps of compact() leaves only the new file
+  if (!_fs->exists(_path) && _fs->exists(_tmp_path))
+    _fs->rename(_tmp_path, _path);
+
+  File f = _fs->open(_path, FILE_READ);
+  _stats.file_bytes = f ? f.size() : 0;
+  if (f)
+    f.close();
+  return true;
+}
+
+bool LogStore::exists() const { return _fs && _fs->exists(_path); }
+
+bool LogStore::replay(Visitor visit, void *ctx) {
+  if (!_fs)
+    return false;
+  File f = _fs->open(_path, FILE_READ);
+  if (!f)
+    return false;
+
+  char magic[LOG_MAGIC_LEN];
+  if (f.read((uint8_t *)magic, LOG_MAGIC_LEN) != LOG_MAGIC_LEN ||
+      memcmp(magic, LOG_MAGIC, LOG_MAGIC_LEN) != 0) {
+    f.close();
+    _damaged = true;
+    _stats.torn++;
+    return false;
+  }
+
+  // Payloads are read into one scratch block sized for the largest record
+  char *payload = nullptr;
+  size_t payload_cap = 0;
+  size_t good = LOG_MAGIC_LEN; // End of the last intact record
+  uint8_t h[LOG_RECORD_HEADER];
+  while (f.read(h, LOG_RECORD_HEADER) == LOG_RECORD_HEADER) {
+    size_t len = h[1] | (h[2] << 8);
+    if (len + 1 > payload_cap) {
+      heap_caps_free(payload);
+      payload_cap = len + 1;
+      payload = (char *)heap_caps_malloc(payload_cap,
+                                         MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+      if (!payload) {
+        payload_cap = 0;
+        break;
+      }
+    }
+    if (f.read((uint8_t *)payload, len) != len)
+      break;
+    payload[len] = '\0';
+
+    uint32_t crc = crc32_update(0, h, 3);
+    crc = crc32_update(crc, (const uint8_t *)payload, len);
+    uint32_t stored =
+        h[3] | (h[4] << 8) | (h[5] << 16) | ((uint32_t)h[6] << 24);
+    if (crc != stored)
+      break;
+
+    visit(h[0], payload, len, ctx);
+    _stats.records++;
+    good += LOG_RECORD_HEADER + len;
+  }
+
+  // Anything past the last intact record is a torn or corrupt tail
+  if (good < f.size()) {
+    _damaged = true;
+    _stats.torn++;
+  }
+  f.close();
+  heap_caps_free(payload);
+  return true;
+}
+
+bool LogStore::write_header(const char *path) {
+  File f = _fs->open(path, FILE_WRITE);
+  if (!f)
+    return false;
+  bool ok =
+      f.write((const uint8_t *)LOG_MAGIC, LOG_MAGIC_LEN) == LOG_MAGIC_LEN;
+  f.close();
+  return ok;
+}
+
+bool LogStore::append(uint8_t type, const char *data, size_t len) {
+  if (!_fs || len > LOG_MAX_RECORD)
+    return false;
+  size_t need = LOG_RECORD_HEADER + len;
+  if (_batch_len + need > LOG_BATCH_BYTES && !flush())
+    return false;
+  _stats.records++;
+
+  uint8_t h[LOG_RECORD_HEADER];
+  encode_header(h, type, data, len);
+  if (need <= LOG_BATCH_BYTES) {
+    memcpy(_batch + _batch_len, h, LOG_RECORD_HEADER);
+    memcpy(_batch + _batch_len + LOG_RECORD_HEADER, data, len);
+    _batch_len += need;
+    return true;
+  }
+
+  // Larger than a batch: the batch is empty now, write straight through
+  if (!_fs->exists(_target) && !write_header(_target))
+    return false;
+  File f = _fs->open(_target, FILE_APPEND);
+  if (!f)
+    return false;
+  bool ok = f.write(h, LOG_RECORD_HEADER) == LOG_RECORD_HEADER &&
+            f.write((const uint8_t *)data, len) == len;
+  _stats.file_bytes = f.size();
+  f.close();
+  _stats.flushes++;
+  return ok;
+}
+
+bool LogStore::flush() {
+  if (!_fs)
+    return false;
+  if (!_batch_len)
+    return true;
+  if (!_fs->exists(_target) && !write_header(_target))
+    return false;
+  File f = _fs->open(_target, FILE_APPEND);
+  if (!f)
+    return false;
+  size_t n = f.write((const uint8_t *)_batch, _batch_len);
+  _stats.file_bytes = f.size();
+  f.close();
+  _stats.flushes++;
+  if (n != _batch_len)
+    return false;
+  _batch_len = 0;
+  return true;
+}
+
+bool LogStore::needs_compaction() const {
+  return _fs && (_damaged || _stats.file_bytes > LOG_COMPACT_BYTES);
+}
+
+bool LogStore::compact(Emitter emit, void *ctx) {
+  if (!_fs || !flush())
+    return false;
+
+  _fs->remove(_tmp_path);
+  if (!write_header(_tmp_path))
+    return false;
+  _target = _tmp_path;
+  _stats.records = 0;
+  emit(*this, ctx);
+  bool ok = flush();
+  _target = _path;
+  if (!ok) {
+    _batch_len = 0;
+    _fs->remove(_tmp_path);
+    return false;
+  }
+
+  // Until the rename the old log is intact; begin() finishes an
+  // interrupted swap
+  _fs->remove(_path);
+  if (!_fs->rename(_tmp_path, _path))
+    return false;
+  File f = _fs->open(_path, FILE_READ);
+  _stats.file_bytes = f ? f.size() : 0;
+  if (f)
+    f.close();
+  _damaged = false;
+  _stats.compactions++;
+  return true;
+}
+
+LogStore::Stats LogStore::stats() const {
+  Stats s = _stats;
+  s.pending = _batch_len;
+  return s;
+}
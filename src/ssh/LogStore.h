@@ -0,0 +1,75 @@
+#ifndef LOG_STORE_H
+#define LOG_STORE_H
+
+#include <FS.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * LogStore
+ * Append-only record log on any Arduino filesystem (FFat, LittleFS, SD).
+ * Each record is a 7-byte header (type, u16 length, CRC-32) followed by
+ * the payload, so the file only ever grows at the end and a torn write
+ * loses at most the last record.
+ *
+ * Appends collect in a RAM batch and reach flash in one write per flush().
+ * State is rebuilt by replaying the log in order; compact() rewrites it
+ * from the caller's live state once it grows past LOG_COMPACT_BYTES.
+ * Not thread-safe: owned by a single task.
+ */
+
+#define LOG_BATCH_BYTES 2048
+#define LOG_COMPACT_BYTES (64 * 1024)
+#define LOG_RECORD_HEADER 7
+#define LOG_MAX_RECORD 0xFFFF
+
+class LogStore {
+public:
+  struct Stats {
+    uint32_t file_bytes;  // Log size on flash, excluding the batch
+    uint32_t pending;     // Bytes batched, not yet flushed
+    uint32_t records;     // Records replayed or appended since compaction
+    uint32_t flushes;     // Batched writes to flash
+    uint32_t compactions; // Rewrites from live state
+    uint32_t torn;        // Replays that stopped at a damaged record
+  };
+
+  typedef void (*Visitor)(uint8_t type, const char *data, size_t len,
+                          void *ctx);
+  typedef void (*Emitter)(LogStore &log, void *ctx);
+
+  ~LogStore();
+
+  bool begin(fs::FS &fs, const char *path);
+  bool ready() const { return _fs != nullptr; }
+  bool exists() const;
+
+  // Visit every intact record in file order. A damaged record ends the
+  // replay and flags the log for compaction.
+  bool replay(Visitor visit, void *ctx);
+
+  // Queue a record; the batch is flushed first when it would overflow
+  bool append(uint8_t type, const char *data, size_t len);
+  bool flush();
+
+  // Rewrite the log: emit appends the live records, which go to a fresh
+  // file that replaces the old one only once it is complete
+  bool needs_compaction() const;
+  bool compact(Emitter emit, void *ctx);
+
+  Stats stats() const;
+
+private:
+  fs::FS *_fs = nullptr;
+  char _path[32] = {0};
+  char _tmp_path[36] = {0};
+  const char *_target = _path; // File that flush() appends to
+  char *_batch = nullptr;
+  size_t _batch_len = 0;
+  bool _damaged = false;
+  Stats _stats = {0, 0, 0, 0, 0, 0};
+
+  bool write_header(const char *path);
+};
+
+#endif // LOG_STORE_H
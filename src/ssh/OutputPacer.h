@@ -0,0 +1,117 @@
+#ifndef OUTPUT_PACER_H
+#define OUTPUT_PACER_H
+
+#include <freertos/FreeRTOS.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * OutputPacer
+ * Decides when PTY bytes queued by the receive task are handed to the
+ * LVGL task for parsing and drawing.
+ *
+ * - Bulk output is presented at most once per display frame, so the UI
+ *   parses large chunks instead of redrawing for every TCP segment.
+ * - A small chunk after a quiet spell (an echoed keystroke) is presented
+ *   at once; typing does not wait for a frame boundary.
+ * - Anything held back has a deadline one frame after the last present;
+ *   the owner arms a timer for tail_wait_us() so a burst's tail never
+ *   waits for more data.
+ *
+ * Producer side (on_data, presented, tail_wait_us) is safe from any task.
+ * The render counters are kept by the LVGL task only.
+ */
+
+#ifndef OUTPUT_FRAME_MS
+#define OUTPUT_FRAME_MS 33 // LVGL's default display refresh period
+#endif
+#ifndef OUTPUT_ECHO_BYTES
+#define OUTPUT_ECHO_BYTES 64 // Larger chunks are paced even after a pause
+#endif
+#define OUTPUT_RATE_WINDOW_US 1000000
+
+class OutputPacer {
+public:
+  // Bytes queued; true if they should be presented now
+  bool on_data(size_t len, int64_t now_us) {
+    portENTER_CRITICAL(&_mux);
+    bool quiet = now_us - _last_data_us >= OUTPUT_FRAME_MS * 1000;
+    _last_data_us = now_us;
+    _pending += len;
+    bool due = now_us - _last_present_us >= OUTPUT_FRAME_MS * 1000;
+    bool echo = quiet && _pending <= OUTPUT_ECHO_BYTES;
+    if (echo && !due)
+      _echoes++;
+    portEXIT_CRITICAL(&_mux);
+    return due || echo;
+  }
+
+  void presented(int64_t now_us) {
+    portENTER_CRITICAL(&_mux);
+    _pending = 0;
+    _last_present_us = now_us;
+    portEXIT_CRITICAL(&_mux);
+  }
+
+  // Until the held-back bytes are due (at least 1 ms)
+  uint32_t tail_wait_us(int64_t now_us) {
+    portENTER_CRITICAL(&_mux);
+    int64_t wait = _last_present_us + OUTPUT_FRAME_MS * 1000 - now_us;
+    portEXIT_CRITICAL(&_mux);
+    return wait > 1000 ? (uint32_t)wait : 1000;
+  }
+
+  // ---- LVGL task ----
+
+  // One drain pass fed bytes to the grids; counts as an output frame
+  void note_frame(size_t bytes, int64_t now_us) {
+    roll(now_us);
+    _win_frames++;
+    _win_bytes += bytes;
+  }
+
+  // "Output 30 fps, 41.2 KB/s (peak 30 fps, 88.0 KB/s), 12 echoes"
+  int format(char *out, size_t max, int64_t now_us) {
+    roll(now_us);
+    return snprintf(out, max,
+                    "Output %u fps, %.1f KB/s (peak %u fps, %.1f KB/s), %u "
+                    "echoes",
+                    (unsigned)_fps, _bps / 1024.0, (unsigned)_peak_fps,
+                    _peak_bps / 1024.0, (unsigned)_echoes);
+  }
+
+private:
+  portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+  int64_t _last_data_us = INT64_MIN / 2;
+  int64_t _last_present_us = INT64_MIN / 2;
+  size_t _pending = 0; // Bytes since the last present
+  uint32_t _echoes = 0; // Small chunks presented ahead of the frame cadence
+
+  int64_t _win_start_us = 0;
+  uint32_t _win_frames = 0;
+  uint32_t _win_bytes = 0;
+  uint32_t _fps = 0; // Last complete window
+  uint32_t _bps = 0;
+  uint32_t _peak_fps = 0;
+  uint32_t _peak_bps = 0;
+
+  // Close the rate window once it is a second old. Rates are over the
+  // window's real length, so output after a quiet spell averages down.
+  void roll(int64_t now_us) {
+    int64_t age = now_us - _win_start_us;
+    if (age < OUTPUT_RATE_WINDOW_US)
+      return;
+    _fps = (uint32_t)((uint64_t)_win_frames * 1000000 / age);
+    _bps = (uint32_t)((uint64_t)_win_bytes * 1000000 / age);
+    if (_fps > _peak_fps)
+      _peak_fps = _fps;
+    if (_bps > _peak_bps)
+      _peak_bps = _bps;
+    _win_start_us = now_us;
+    _win_frames = 0;
+    _win_bytes = 0;
+  }
+};
+
+#endif // OUTPUT_PACER_H
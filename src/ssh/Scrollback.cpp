@@ -0,0 +1,65 @@
+/**
+ * Scrollback - PSRAM ring of terminal history lines
+ */
+
+#include "Scrollback.h"
+#include <esp_heap_caps.h>
+#include <string.h>
+
+Scrollback::~Scrollback() {
+  heap_caps_free(_cells);
+  heap_caps_free(_len);
+}
+
+bool Scrollback::begin(uint16_t cols, uint32_t lines) {
+  heap_caps_free(_cells);
+  heap_caps_free(_len);
+  _cells = nullptr;
+  _len = nullptr;
+  _cap = 0;
+  clear();
+  if (!cols || !lines)
+    return false;
+
+  // History is bulk storage: PSRAM only, never internal RAM
+  _cells = (TermCell *)heap_caps_malloc((size_t)lines * cols * sizeof(TermCell),
+                                        MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  _len = (uint16_t *)heap_caps_malloc(lines * sizeof(uint16_t),
+                                      MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!_cells || !_len) {
+    heap_caps_free(_cells);
+    heap_caps_free(_len);
+    _cells = nullptr;
+    _len = nullptr;
+    return false;
+  }
+  _cap = lines;
+  _stride = cols;
+  return true;
+}
+
+void Scrollback::clear() {
+  _head = 0;
+  _count = 0;
+}
+
+void Scrollback::push(const TermCell *cells, uint16_t cols) {
+  if (!_cap)
+    return;
+  uint16_t n = cols < _stride ? cols : _stride;
+  while (n > 0 && cells[n - 1].glyph == ' ' &&
+         (cells[n - 1].flags & TERM_ATTR_DEFAULT_BG) &&
+         !(cells[n - 1].flags & (TERM_ATTR_INVERSE | TERM_ATTR_UNDERLINE)))
+    n--;
+
+  memcpy(&_cells[(size_t)_head * _stride], cells, n * sizeof(TermCell));
+  _len[_head] = n;
+  _head = (_head + 1) % _cap;
+  if (_count < _cap)
+    _count++;
+  _total++;
+}
+
+size_t Scrollback::memory_bytes() const {
+  return (size_t)_cap * (_stride * sizeof(TermCell) + sizeof(uint16_t));
+}
@@ -0,0 +1,55 @@
+#ifndef SCROLLBACK_H
+#define SCROLLBACK_H
+
+#include "TerminalGrid.h"
+
+/**
+ * Scrollback
+ * Ring of line records holding the rows that scroll off the top of the
+ * main screen, with their colours and attributes. Each slot is a fixed
+ * stride of cells plus a used length, so append and eviction of the oldest
+ * line are O(1) and lookup by index is direct. Storage is one PSRAM block
+ * of lines * stride cells, allocated once in begin().
+ */
+
+#ifndef SCROLLBACK_LINES
+#define SCROLLBACK_LINES 4000 // ~1.6 MB at 68 columns
+#endif
+
+class Scrollback {
+public:
+  ~Scrollback();
+
+  // Allocate lines * cols cells. Wider rows pushed later are truncated.
+  bool begin(uint16_t cols, uint32_t lines = SCROLLBACK_LINES);
+  void clear();
+
+  // Append one row, evicting the oldest line when full. Trailing default
+  // blanks are not kept.
+  void push(const TermCell *cells, uint16_t cols);
+
+  uint32_t count() const { return _count; }
+  uint32_t capacity() const { return _cap; }
+  uint16_t stride() const { return _stride; }
+  // Lines ever pushed; never decreases, so it doubles as a line id base
+  uint32_t total() const { return _total; }
+  size_t memory_bytes() const;
+
+  // Line i, 0 = oldest held. len receives the stored cell count.
+  const TermCell *line(uint32_t i, uint16_t *len) const {
+    uint32_t slot = (_head + _cap - _count + i) % _cap;
+    *len = _len[slot];
+    return &_cells[(size_t)slot * _stride];
+  }
+
+private:
+  TermCell *_cells = nullptr;
+  uint16_t *_len = nullptr;
+  uint32_t _cap = 0;
+  uint32_t _head = 0; // Next slot to write
+  uint32_t _count = 0;
+  uint32_t _total = 0;
+  uint16_t _stride = 0;
+};
+
+#endif // SCROLLBACK_H
@@ -0,0 +1,198 @@
+/**
+ * ScrollbackSearch - trigram-sketch index and incremental history search
+ */
+
+#include "ScrollbackSearch.h"
+#include <esp_heap_caps.h>
+#include <string.h>
+
+// ASCII case folding; anything outside ASCII never matches a query byte
+static inline uint8_t fold(uint16_t glyph) {
+  if (glyph >= 'A' && glyph <= 'Z')
+    return glyph + 32;
+  return glyph < 128 ? glyph : 0xFF;
+}
+
+// Two sketch bits per trigram, from a well-mixed hash (murmur3 fmix32)
+static inline void trigram_set(uint32_t *sketch, uint8_t a, uint8_t b,
+                               uint8_t c) {
+  uint32_t h = (uint32_t)a << 16 | (uint32_t)b << 8 | c;
+  h ^= h >> 16;
+  h *= 0x85EBCA6Bu;
+  h ^= h >> 13;
+  h *= 0xC2B2AE35u;
+  h ^= h >> 16;
+  const uint32_t mask = SEARCH_SKETCH_WORDS * 32 - 1;
+  uint32_t b1 = h & mask;
+  uint32_t b2 = (h >> 16) & mask;
+  sketch[b1 >> 5] |= 1u << (b1 & 31);
+  sketch[b2 >> 5] |= 1u << (b2 & 31);
+}
+
+ScrollbackSearch::~ScrollbackSearch() {
+  heap_caps_free(_sketch);
+  heap_caps_free(_block_id);
+}
+
+bool ScrollbackSearch::begin(Scrollback *sb) {
+  _sb = sb;
+  if (!sb || !sb->capacity())
+    return false;
+  // One spare block: the newest block can be partial while the oldest one
+  // is still partly held
+  _nblocks = sb->capacity() / SEARCH_BLOCK_LINES + 2;
+  _sketch = (uint32_t *)heap_caps_malloc(
+      _nblocks * SEARCH_SKETCH_WORDS * sizeof(uint32_t),
+      MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  _block_id = (uint32_t *)heap_caps_malloc(_nblocks * sizeof(uint32_t),
+                                           MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!_sketch || !_block_id)
+    return false;
+  memset(_block_id, 0xFF, _nblocks * sizeof(uint32_t));
+  _indexed = sb->total() - sb->count(); // Index whatever is already held
+  return true;
+}
+
+void ScrollbackSearch::index_line(uint32_t id) {
+  uint32_t block = id / SEARCH_BLOCK_LINES;
+  uint32_t slot = block % _nblocks;
+  uint32_t *sketch = &_sketch[slot * SEARCH_SKETCH_WORDS];
+  if (_block_id[slot] != block) {
+    _block_id[slot] = block;
+    memset(sketch, 0, SEARCH_SKETCH_WORDS * sizeof(uint32_t));
+  }
+
+  uint16_t len;
+  const TermCell *cells = line_by_id(id, &len);
+  for (int i = 0; i + 2 < len; i++)
+    trigram_set(sketch, fold(cells[i].glyph), fold(cells[i + 1].glyph),
+                fold(cells[i + 2].glyph));
+}
+
+int ScrollbackSearch::find(const TermCell *cells, uint16_t len,
+                           const char *query, uint16_t qlen, int from) {
+  for (int i = from; i + qlen <= len; i++) {
+    uint16_t k = 0;
+    while (k < qlen && fold(cells[i + k].glyph) == (uint8_t)query[k])
+      k++;
+    if (k == qlen)
+      return i;
+  }
+  return -1;
+}
+
+bool ScrollbackSearch::test_line(uint32_t id) {
+  uint16_t len;
+  const TermCell *cells = line_by_id(id, &len);
+  return find(cells, len, _query, _qlen, 0) >= 0;
+}
+
+void ScrollbackSearch::add_match(uint32_t id) {
+  if (_mcount == SEARCH_MAX_MATCHES)
+    _mdropped = true;
+  _matches[_mhead] = id;
+  _mhead = (_mhead + 1) % SEARCH_MAX_MATCHES;
+  if (_mcount < SEARCH_MAX_MATCHES)
+    _mcount++;
+}
+
+uint32_t ScrollbackSearch::match_count() {
+  // Drop matches whose lines have been evicted
+  uint32_t oldest = oldest_id();
+  while (_mcount && match_id(0) < oldest)
+    _mcount--;
+  return _mcount;
+}
+
+uint32_t ScrollbackSearch::update() {
+  if (!_sketch)
+    return 0;
+  uint32_t total = _sb->total();
+  uint32_t oldest = oldest_id();
+  if (_indexed < oldest)
+    _indexed = oldest; // Evicted (or cleared) before we saw them
+
+  uint32_t added = 0;
+  for (uint32_t id = _indexed; id < total; id++) {
+    index_line(id);
+    if (_qlen && test_line(id)) {
+      add_match(id);
+      added++;
+    }
+  }
+  _indexed = total;
+  return added;
+}
+
+// Keep the matches that still match the (longer) query, in order
+void ScrollbackSearch::refine_matches() {
+  uint32_t n = match_count();
+  uint32_t start = (_mhead + SEARCH_MAX_MATCHES - n) % SEARCH_MAX_MATCHES;
+  uint32_t kept = 0;
+  for (uint32_t i = 0; i < n; i++) {
+    uint32_t id = _matches[(start + i) % SEARCH_MAX_MATCHES];
+    if (test_line(id))
+      _matches[(start + kept++) % SEARCH_MAX_MATCHES] = id;
+  }
+  _mhead = (start + kept) % SEARCH_MAX_MATCHES;
+  _mcount = kept;
+}
+
+void ScrollbackSearch::set_query(const char *query) {
+  update(); // Index is current before the rescan
+
+  char prev[SEARCH_MAX_QUERY + 1];
+  memcpy(prev, _query, sizeof(prev));
+  uint16_t prev_len = _qlen;
+  _qlen = 0;
+  for (const char *p = query; *p && _qlen < SEARCH_MAX_QUERY; p++)
+    _query[_qlen++] = fold((uint8_t)*p);
+  _query[_qlen] = '\0';
+
+  // Every line holding the new query holds the previous one: when the
+  // match list is complete, only those lines need a look
+  if (prev_len && _qlen >= prev_len && !_mdropped && _sketch &&
+      strstr(_query, prev)) {
+    refine_matches();
+    return;
+  }
+
+  _mhead = 0;
+  _mcount = 0;
+  _mdropped = false;
+  _blocks_scanned = 0;
+  _blocks_skipped = 0;
+  if (!_qlen || !_sketch || !_sb->count())
+    return;
+
+  // Query trigrams; shorter queries cannot be filtered and scan everything
+  memset(_qmask, 0, sizeof(_qmask));
+  for (int i = 0; i + 2 < _qlen; i++)
+    trigram_set(_qmask, _query[i], _query[i + 1], _query[i + 2]);
+
+  uint32_t first = oldest_id();
+  uint32_t end = _sb->total();
+  for (uint32_t block = first / SEARCH_BLOCK_LINES;
+       block * SEARCH_BLOCK_LINES < end; block++) {
+    uint32_t slot = block % _nblocks;
+    const uint32_t *sketch = &_sketch[slot * SEARCH_SKETCH_WORDS];
+    bool candidate = _block_id[slot] == block;
+    for (int w = 0; candidate && w < SEARCH_SKETCH_WORDS; w++)
+      candidate = (sketch[w] & _qmask[w]) == _qmask[w];
+    if (!candidate) {
+      _blocks_skipped++;
+      continue;
+    }
+    _blocks_scanned++;
+
+    uint32_t from = block * SEARCH_BLOCK_LINES;
+    uint32_t to = from + SEARCH_BLOCK_LINES;
+    if (from < first)
+      from = first;
+    if (to > end)
+      to = end;
+    for (uint32_t id = from; id < to; id++)
+      if (test_line(id))
+        add_match(id);
+  }
+}
@@ -0,0 +1,87 @@
+#ifndef SCROLLBACK_SEARCH_H
+#define SCROLLBACK_SEARCH_H
+
+#include "Scrollback.h"
+
+/**
+ * ScrollbackSearch
+ * Case-insensitive substring search over Scrollback history.
+ *
+ * History lines are indexed in blocks of SEARCH_BLOCK_LINES: each block
+ * keeps a 1024-bit sketch with two hashed bits per trigram that occurs in
+ * it, so a query only scans blocks whose sketch holds every bit of its
+ * trigrams. Small blocks keep the sketch sparse enough to reject most
+ * blocks for a query that matches nowhere (see test_scrollback). Lines are
+ * addressed by their Scrollback id (total() at push time), so the index
+ * and the match list stay valid while old lines are evicted.
+ *
+ * update() indexes only lines pushed since the previous call and tests
+ * just those against the active query: streaming output never triggers a
+ * rescan of the whole buffer. A query that extends the previous one (the
+ * user typing on) only re-tests the previous matches.
+ */
+
+#define SEARCH_BLOCK_LINES 8
+#define SEARCH_SKETCH_WORDS 32 // 1024 bits, 128 B per block
+#define SEARCH_MAX_QUERY 32
+#define SEARCH_MAX_MATCHES 512 // Newest matches kept when more are found
+
+class ScrollbackSearch {
+public:
+  ~ScrollbackSearch();
+
+  bool begin(Scrollback *sb);
+
+  // Replace the query and rescan history through the block sketches
+  void set_query(const char *query);
+  const char *query() const { return _query; }
+  bool active() const { return _qlen > 0; }
+
+  // Index lines pushed since the last call; returns matches added
+  uint32_t update();
+
+  // Matches still held in history, 0 = oldest
+  uint32_t match_count();
+  uint32_t match_id(uint32_t i) const {
+    return _matches[(_mhead + SEARCH_MAX_MATCHES - _mcount + i) %
+                    SEARCH_MAX_MATCHES];
+  }
+
+  // Find the next occurrence of query in cells from col; -1 if none
+  static int find(const TermCell *cells, uint16_t len, const char *query,
+                  uint16_t qlen, int from);
+
+  // Index effectiveness for the last set_query()
+  uint32_t blocks_scanned() const { return _blocks_scanned; }
+  uint32_t blocks_skipped() const { return _blocks_skipped; }
+
+private:
+  Scrollback *_sb = nullptr;
+  uint32_t *_sketch = nullptr;   // nblocks * SEARCH_SKETCH_WORDS
+  uint32_t *_block_id = nullptr; // Block number held in each slot
+  uint32_t _nblocks = 0;
+  uint32_t _indexed = 0; // Lines [0, _indexed) have been indexed
+
+  char _query[SEARCH_MAX_QUERY + 1] = {0};
+  uint16_t _qlen = 0;
+  uint32_t _qmask[SEARCH_SKETCH_WORDS];
+
+  uint32_t _matches[SEARCH_MAX_MATCHES];
+  uint32_t _mhead = 0;
+  uint32_t _mcount = 0;
+  bool _mdropped = false; // Oldest matches pushed out of the list
+
+  uint32_t _blocks_scanned = 0;
+  uint32_t _blocks_skipped = 0;
+
+  uint32_t oldest_id() const { return _sb->total() - _sb->count(); }
+  const TermCell *line_by_id(uint32_t id, uint16_t *len) const {
+    return _sb->line(id - oldest_id(), len);
+  }
+  void index_line(uint32_t id);
+  bool test_line(uint32_t id);
+  void add_match(uint32_t id);
+  void refine_matches();
+};
+
+#endif // SCROLLBACK_SEARCH_H
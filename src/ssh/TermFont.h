@@ -0,0 +1,27 @@
+#ifndef TERM_FONT_H
+#define TERM_FONT_H
+
+#include <stdint.h>
+
+/**
+ * TermFont
+ * Fixed-cell bitmap font for the terminal: every glyph is exactly one cell,
+ * stored as 4-bit coverage in flash. GlyphAtlas expands glyphs to RGB565
+ * for the colours in use.
+ */
+
+#define TERM_FONT_WIDTH 6
+#define TERM_FONT_HEIGHT 12
+#define TERM_FONT_GLYPH_BYTES (TERM_FONT_WIDTH * TERM_FONT_HEIGHT / 2)
+
+struct TermFont {
+  uint8_t w;
+  uint8_t h;
+  uint16_t count;
+  const uint16_t *codepoints; // Sorted; printable ASCII first, in order
+  const uint8_t *coverage;    // count * TERM_FONT_GLYPH_BYTES
+};
+
+extern const TermFont term_font_6x12;
+
+#endif // TERM_FONT_H
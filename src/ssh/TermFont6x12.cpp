@@ -0,0 +1,909 @@
+/**
+ * TermFont6x12 - 6x12 terminal cell font, 4-bit coverage
+ *
+ * Printable ASCII, Latin-1 and the DEC special graphics symbols rendered
+ * from DejaVu Sans Mono (Bitstream Vera licence) at 10 px, hinted and
+ * slightly gamma-lifted, on a baseline 9 px from the top of the cell.
+ * Box drawing, block and scan line characters are drawn to the cell
+ * edges so borders join up.
+ */
+
+#include "TermFont.h"
+
+static const uint16_t codepoints[216] = {
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028,
+    0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A,
+    0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043,
+    0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C,
+    0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055,
+    0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+    0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079,
+    0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x00A1, 0x00A2, 0x00A3, 0x00A4,
+    0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD,
+    0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6,
+    0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+    0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8,
+    0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, 0x00D0, 0x00D1,
+    0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA,
+    0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF, 0x00E0, 0x00E1, 0x00E2, 0x00E3,
+    0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC,
+    0x00ED, 0x00EE, 0x00EF, 0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5,
+    0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE,
+    0x00FF, 0x03C0, 0x2260, 0x2264, 0x2265, 0x23BA, 0x23BB, 0x23BC, 0x23BD,
+    0x2500, 0x2502, 0x250C, 0x2510, 0x2514, 0x2518, 0x251C, 0x2524, 0x252C,
+    0x2534, 0x253C, 0x2580, 0x2584, 0x2588, 0x2591, 0x2592, 0x2593, 0x25C6
+};
+
+// Two pixels per byte, left pixel in the high nibble, rows top down
+static const uint8_t coverage[216][TERM_FONT_GLYPH_BYTES] = {
+    // U+0020
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '!'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00,
+      0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '"'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x99, 0x70, 0x07, 0x99, 0x70,
+      0x07, 0x99, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '#'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xA4, 0x00, 0xD0, 0xD0,
+      0x8F, 0xFF, 0xFF, 0x07, 0x87, 0x80, 0xFF, 0xFF, 0xF8, 0x0D, 0x0D, 0x00,
+      0x3B, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '$'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x08, 0xFF, 0xF0,
+      0x1E, 0x47, 0x00, 0x0D, 0xAA, 0x10, 0x00, 0x7C, 0xD3, 0x00, 0x38, 0xB7,
+      0x2F, 0xFF, 0xB1, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '%'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC1, 0x00, 0xC3, 0xA5, 0x00,
+      0x7F, 0xC3, 0x96, 0x02, 0x99, 0x10, 0x6A, 0x3C, 0xF7, 0x00, 0x5B, 0x3C,
+      0x00, 0x1C, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '&'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x0D, 0x40, 0x00,
+      0x0B, 0xB0, 0x00, 0x79, 0x89, 0x0C, 0xB4, 0x0B, 0x8B, 0x9B, 0x24, 0xF5,
+      0x1B, 0xFD, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+0027
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00,
+      0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '('
+    {0x00, 0x00, 0x00, 0x00, 0x0C, 0x20, 0x00, 0x5B, 0x00, 0x00, 0xB6, 0x00,
+      0x00, 0xD2, 0x00, 0x00, 0xE1, 0x00, 0x00, 0xD2, 0x00, 0x00, 0xB6, 0x00,
+      0x00, 0x5B, 0x00, 0x00, 0x0C, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // ')'
+    {0x00, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x6B, 0x00,
+      0x00, 0x2E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x6B, 0x00,
+      0x00, 0xB5, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '*'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x66, 0xA2, 0x05, 0xDD, 0x50,
+      0x05, 0xDD, 0x50, 0x1B, 0x66, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '+'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00,
+      0x00, 0x88, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // ','
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0xAC, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x00},
+    // '-'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x60, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '.'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '/'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x07, 0xA0,
+      0x00, 0x0D, 0x20, 0x00, 0x7A, 0x00, 0x00, 0xD3, 0x00, 0x06, 0xB0, 0x00,
+      0x0D, 0x40, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '0'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEE, 0x70, 0x1E, 0x44, 0xF2,
+      0x5C, 0x00, 0xC6, 0x6B, 0x88, 0xB7, 0x5C, 0x00, 0xC6, 0x1E, 0x44, 0xF2,
+      0x07, 0xEE, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '1'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFD, 0x00, 0x00, 0x3D, 0x00,
+      0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00,
+      0x0C, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '2'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFE, 0x70, 0x49, 0x25, 0xF1,
+      0x00, 0x01, 0xE0, 0x00, 0x0B, 0x70, 0x00, 0xA7, 0x00, 0x1B, 0x70, 0x00,
+      0x5F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '3'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xEE, 0x70, 0x29, 0x24, 0xF0,
+      0x00, 0x04, 0xE0, 0x02, 0xFF, 0x70, 0x00, 0x03, 0xE3, 0x67, 0x13, 0xE4,
+      0x1A, 0xFE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '4'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xA0, 0x00, 0xA9, 0xA0,
+      0x06, 0x78, 0xA0, 0x2A, 0x08, 0xA0, 0x9F, 0xFF, 0xFA, 0x00, 0x08, 0xA0,
+      0x00, 0x08, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '5'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x0E, 0x00, 0x00,
+      0x0F, 0xFE, 0x60, 0x00, 0x06, 0xF1, 0x00, 0x00, 0xD4, 0x00, 0x05, 0xE1,
+      0x6F, 0xFE, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '6'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xDF, 0xE0, 0x1E, 0x70, 0x00,
+      0x5D, 0x00, 0x00, 0x6C, 0xDF, 0xB0, 0x5E, 0x32, 0xD6, 0x1E, 0x32, 0xD6,
+      0x07, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '7'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x02, 0xD0,
+      0x00, 0x09, 0x80, 0x00, 0x0E, 0x20, 0x00, 0x6B, 0x00, 0x00, 0xC5, 0x00,
+      0x04, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '8'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x90, 0x3F, 0x32, 0xE3,
+      0x1E, 0x32, 0xE2, 0x08, 0xFF, 0x80, 0x4D, 0x22, 0xD4, 0x6D, 0x22, 0xD6,
+      0x0A, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '9'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0x70, 0x6D, 0x23, 0xE1,
+      0x6D, 0x23, 0xE5, 0x0B, 0xFD, 0xC6, 0x00, 0x00, 0xD5, 0x00, 0x08, 0xE1,
+      0x0E, 0xFD, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // ':'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // ';'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0xAC, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x00},
+    // '<'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xA9,
+      0x17, 0xCC, 0x60, 0xAE, 0x40, 0x00, 0x17, 0xCC, 0x60, 0x00, 0x04, 0xA9,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '='
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '>'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x40, 0x00,
+      0x06, 0xCC, 0x71, 0x00, 0x04, 0xEA, 0x06, 0xCC, 0x71, 0x9A, 0x40, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '?'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x90, 0x00, 0x03, 0xF0,
+      0x00, 0x0B, 0x90, 0x00, 0x8B, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '@'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xDF, 0xC2, 0x3E, 0x51, 0x8A,
+      0xA6, 0x5E, 0xBC, 0xC0, 0xD3, 0x6C, 0xC0, 0xC0, 0x0C, 0xD0, 0xD3, 0x6C,
+      0xA7, 0x5E, 0xBC, 0x2E, 0x72, 0x00, 0x04, 0xCF, 0xE0, 0x00, 0x00, 0x00},
+    // 'A'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x02, 0xDC, 0x20,
+      0x07, 0x88, 0x80, 0x0C, 0x33, 0xC0, 0x1F, 0xFF, 0xF2, 0x7A, 0x00, 0xA7,
+      0xB7, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'B'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xA0, 0x4D, 0x02, 0xE5,
+      0x4D, 0x02, 0xE4, 0x4F, 0xFF, 0xB0, 0x4D, 0x01, 0xB7, 0x4D, 0x01, 0xB9,
+      0x4F, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'C'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xB0, 0x0E, 0x81, 0x74,
+      0x4E, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x0E, 0x81, 0x74,
+      0x04, 0xDF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'D'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0x40, 0x6B, 0x17, 0xE1,
+      0x6B, 0x00, 0xD6, 0x6B, 0x00, 0xB7, 0x6B, 0x00, 0xD6, 0x6B, 0x17, 0xE1,
+      0x6F, 0xFD, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'E'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF6, 0x1F, 0x00, 0x00,
+      0x1F, 0x00, 0x00, 0x1F, 0xFF, 0xF3, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
+      0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'F'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF8, 0x0E, 0x30, 0x00,
+      0x0E, 0x30, 0x00, 0x0E, 0xFF, 0xF3, 0x0E, 0x30, 0x00, 0x0E, 0x30, 0x00,
+      0x0E, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'G'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xDF, 0xA0, 0x2E, 0x62, 0x83,
+      0x7B, 0x00, 0x00, 0x9A, 0x0B, 0xF7, 0x7B, 0x00, 0xA7, 0x2E, 0x61, 0xB7,
+      0x05, 0xDF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'H'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x00, 0xB7, 0x6B, 0x00, 0xB7,
+      0x6B, 0x00, 0xB7, 0x6F, 0xFF, 0xF7, 0x6B, 0x00, 0xB7, 0x6B, 0x00, 0xB7,
+      0x6B, 0x00, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'I'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF1, 0x00, 0x99, 0x00,
+      0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00,
+      0x0F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'J'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x06, 0xB0,
+      0x00, 0x06, 0xB0, 0x00, 0x06, 0xB0, 0x00, 0x07, 0xB0, 0x76, 0x1A, 0x90,
+      0x2C, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'K'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x01, 0xC8, 0x6B, 0x1C, 0x80,
+      0x6C, 0xC8, 0x00, 0x6F, 0xD9, 0x00, 0x6C, 0x1E, 0x50, 0x6B, 0x05, 0xE1,
+      0x6B, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'L'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x10, 0x00,
+      0x0F, 0x10, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x10, 0x00, 0x0F, 0x10, 0x00,
+      0x0F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'M'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0xEA, 0xAC, 0x77, 0xCA,
+      0xA7, 0xBB, 0x7A, 0xA6, 0xAA, 0x6A, 0xA6, 0x00, 0x6A, 0xA6, 0x00, 0x6A,
+      0xA6, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'N'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x30, 0xB7, 0x6E, 0xA0, 0xB7,
+      0x6B, 0xD1, 0xB7, 0x6B, 0x88, 0xB7, 0x6B, 0x1D, 0xB7, 0x6B, 0x0A, 0xE7,
+      0x6B, 0x03, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'O'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xEE, 0x80, 0x2F, 0x43, 0xE3,
+      0x6C, 0x00, 0xB7, 0x8B, 0x00, 0xA8, 0x6C, 0x00, 0xB7, 0x2F, 0x43, 0xE3,
+      0x08, 0xEE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'P'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC1, 0x1F, 0x01, 0xC9,
+      0x1F, 0x01, 0xC9, 0x1F, 0xFF, 0xC2, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
+      0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'Q'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xEE, 0x80, 0x2F, 0x43, 0xE3,
+      0x6C, 0x00, 0xB7, 0x8B, 0x00, 0xA8, 0x6C, 0x00, 0xB7, 0x2F, 0x43, 0xE3,
+      0x08, 0xEF, 0x80, 0x00, 0x06, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'R'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x80, 0x6C, 0x04, 0xF3,
+      0x6C, 0x03, 0xE2, 0x6F, 0xFF, 0x60, 0x6C, 0x08, 0xC0, 0x6C, 0x00, 0xD5,
+      0x6C, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'S'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xEE, 0x70, 0x5E, 0x32, 0xA0,
+      0x4D, 0x10, 0x00, 0x06, 0xBB, 0x70, 0x00, 0x00, 0xC5, 0x58, 0x22, 0xD6,
+      0x09, 0xEF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'T'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFD, 0x00, 0x99, 0x00,
+      0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00,
+      0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'U'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0xC6, 0x6C, 0x00, 0xC6,
+      0x6C, 0x00, 0xC6, 0x6C, 0x00, 0xC6, 0x5C, 0x00, 0xC6, 0x3E, 0x33, 0xE4,
+      0x08, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'V'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x8A, 0x5C, 0x00, 0xC6,
+      0x0E, 0x10, 0xE1, 0x0B, 0x55, 0xB0, 0x07, 0xA9, 0x70, 0x02, 0xDD, 0x20,
+      0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'W'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x0F, 0xD3, 0x00, 0x3D,
+      0xB5, 0xBB, 0x5B, 0x87, 0xCC, 0x79, 0x6A, 0xBA, 0xA6, 0x3E, 0x77, 0xE4,
+      0x0F, 0x33, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'X'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x00, 0xB8, 0x0B, 0x75, 0xD0,
+      0x02, 0xDD, 0x30, 0x00, 0xBD, 0x00, 0x05, 0xCB, 0x70, 0x1E, 0x32, 0xE2,
+      0xA9, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'Y'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x9A, 0x1E, 0x33, 0xE1,
+      0x06, 0xBB, 0x60, 0x00, 0xCC, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00,
+      0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'Z'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFA, 0x00, 0x01, 0xD2,
+      0x00, 0x0A, 0x60, 0x00, 0x6A, 0x00, 0x02, 0xC1, 0x00, 0x0B, 0x40, 0x00,
+      0x4F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '['
+    {0x00, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x00, 0xC4, 0x00, 0x00, 0xC4, 0x00,
+      0x00, 0xC4, 0x00, 0x00, 0xC4, 0x00, 0x00, 0xC4, 0x00, 0x00, 0xC4, 0x00,
+      0x00, 0xC4, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+005C
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x0D, 0x40, 0x00,
+      0x06, 0xB0, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x0D, 0x20,
+      0x00, 0x07, 0xA0, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // ']'
+    {0x00, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00,
+      0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x3D, 0x00,
+      0x00, 0x3D, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '^'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x09, 0x98, 0xA0,
+      0x6B, 0x00, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '_'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00},
+    // '`'
+    {0x00, 0x00, 0x00, 0x05, 0xB0, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'a'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0F, 0xFE, 0x80, 0x00, 0x02, 0xE2, 0x1B, 0xFF, 0xF4, 0x6C, 0x23, 0xE4,
+      0x2D, 0xFC, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'b'
+    {0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2E, 0x00, 0x00,
+      0x2E, 0xBF, 0xA0, 0x2F, 0x52, 0xD5, 0x2E, 0x00, 0xA8, 0x2F, 0x52, 0xD5,
+      0x2E, 0xBF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'c'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x04, 0xDF, 0xF4, 0x0D, 0x71, 0x00, 0x0F, 0x00, 0x00, 0x0D, 0x70, 0x00,
+      0x04, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'd'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0xD2, 0x00, 0x00, 0xD2,
+      0x0A, 0xFC, 0xD2, 0x5D, 0x24, 0xF2, 0x7A, 0x00, 0xE2, 0x5D, 0x24, 0xF2,
+      0x0A, 0xFC, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'e'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x08, 0xEF, 0xA0, 0x4D, 0x31, 0xC5, 0x7F, 0xFF, 0xF8, 0x4D, 0x20, 0x00,
+      0x08, 0xEF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'f'
+    {0x00, 0x00, 0x00, 0x00, 0x3E, 0xF4, 0x00, 0x99, 0x00, 0x00, 0xA6, 0x00,
+      0x1F, 0xFF, 0xF4, 0x00, 0xA6, 0x00, 0x00, 0xA6, 0x00, 0x00, 0xA6, 0x00,
+      0x00, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'g'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0A, 0xFC, 0xD2, 0x5D, 0x24, 0xF2, 0x7A, 0x00, 0xE2, 0x5D, 0x24, 0xF2,
+      0x0A, 0xFC, 0xE2, 0x00, 0x04, 0xE0, 0x0D, 0xFE, 0x60, 0x00, 0x00, 0x00},
+    // 'h'
+    {0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00,
+      0x1E, 0xBF, 0xA0, 0x1F, 0x52, 0xE1, 0x1E, 0x00, 0xD3, 0x1E, 0x00, 0xD3,
+      0x1E, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'i'
+    {0x00, 0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0C, 0xFA, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x7A, 0x00,
+      0x3F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'j'
+    {0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0B, 0xFD, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00,
+      0x00, 0x2D, 0x00, 0x00, 0x6C, 0x00, 0x2F, 0xF6, 0x00, 0x00, 0x00, 0x00},
+    // 'k'
+    {0x00, 0x00, 0x00, 0x0E, 0x20, 0x00, 0x0E, 0x20, 0x00, 0x0E, 0x20, 0x00,
+      0x0E, 0x25, 0xC3, 0x0E, 0x7C, 0x20, 0x0E, 0xCD, 0x10, 0x0E, 0x28, 0xB0,
+      0x0E, 0x20, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'l'
+    {0x00, 0x00, 0x00, 0x5F, 0xF3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00,
+      0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xD3, 0x00, 0x00, 0xC6, 0x00,
+      0x00, 0x5E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'm'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x9D, 0xE9, 0xF4, 0x99, 0x9A, 0x89, 0x97, 0x78, 0x6A, 0x97, 0x78, 0x6A,
+      0x97, 0x78, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'n'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x1E, 0xBF, 0xA0, 0x1F, 0x52, 0xE1, 0x1E, 0x00, 0xD3, 0x1E, 0x00, 0xD3,
+      0x1E, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'o'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x09, 0xEF, 0x90, 0x3E, 0x33, 0xE4, 0x6B, 0x00, 0xB6, 0x3E, 0x33, 0xE4,
+      0x09, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'p'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2E, 0xCF, 0xA0, 0x2F, 0x52, 0xD5, 0x2E, 0x00, 0xA7, 0x2F, 0x42, 0xD5,
+      0x2E, 0xCF, 0xA0, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'q'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x09, 0xFC, 0xD4, 0x3E, 0x24, 0xF4, 0x6B, 0x00, 0xD4, 0x4E, 0x24, 0xF4,
+      0x09, 0xFC, 0xD4, 0x00, 0x00, 0xC4, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x00},
+    // 'r'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0xCC, 0xFB, 0x05, 0xF5, 0x00, 0x05, 0xC0, 0x00, 0x05, 0xB0, 0x00,
+      0x05, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 's'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x08, 0xFF, 0xC0, 0x0E, 0x40, 0x00, 0x06, 0xCD, 0x80, 0x00, 0x03, 0xF0,
+      0x0F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 't'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00,
+      0x7F, 0xFF, 0xF1, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE3, 0x00,
+      0x00, 0x8F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'u'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x1E, 0x00, 0xD3, 0x1E, 0x00, 0xD3, 0x1E, 0x00, 0xD3, 0x0E, 0x34, 0xF3,
+      0x09, 0xFC, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'v'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x6B, 0x00, 0xA7, 0x0E, 0x11, 0xE0, 0x0A, 0x77, 0xA0, 0x03, 0xCC, 0x40,
+      0x00, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'w'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xE1, 0x00, 0x0E, 0xB5, 0x00, 0x5B, 0x78, 0xAA, 0x87, 0x2C, 0xAA, 0xB3,
+      0x0E, 0x66, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'x'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x3D, 0x22, 0xD3, 0x05, 0xCC, 0x50, 0x00, 0xCC, 0x00, 0x07, 0xBA, 0x80,
+      0x5D, 0x10, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // 'y'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x5B, 0x00, 0xA8, 0x0D, 0x20, 0xE1, 0x07, 0x97, 0x90, 0x00, 0xDD, 0x30,
+      0x00, 0x9C, 0x00, 0x01, 0xD6, 0x00, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x00},
+    // 'z'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0E, 0xFF, 0xF1, 0x00, 0x07, 0x60, 0x00, 0x67, 0x00, 0x06, 0x70, 0x00,
+      0x0F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '{'
+    {0x00, 0x00, 0x00, 0x00, 0x2D, 0xF0, 0x00, 0x7B, 0x00, 0x00, 0x89, 0x00,
+      0x00, 0xA8, 0x00, 0x0F, 0xE2, 0x00, 0x01, 0xB8, 0x00, 0x00, 0x89, 0x00,
+      0x00, 0x7B, 0x00, 0x00, 0x2D, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '|'
+    {0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00,
+      0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00,
+      0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00},
+    // '}'
+    {0x00, 0x00, 0x00, 0x0E, 0xD2, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x98, 0x00,
+      0x00, 0x8A, 0x00, 0x00, 0x2E, 0xF0, 0x00, 0x8B, 0x10, 0x00, 0x98, 0x00,
+      0x00, 0xB7, 0x00, 0x0E, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // '~'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x5E, 0xD6, 0x38, 0x73, 0x5D, 0xE5, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00A1
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x99, 0x00,
+      0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00},
+    // U+00A2
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+      0x03, 0xCF, 0xF4, 0x0C, 0x89, 0x00, 0x0E, 0x09, 0x00, 0x0C, 0x89, 0x00,
+      0x03, 0xCF, 0xF4, 0x00, 0x09, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00},
+    // U+00A3
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xC1, 0x01, 0xF4, 0x45,
+      0x03, 0xD0, 0x00, 0x3F, 0xFF, 0xB0, 0x04, 0xD0, 0x00, 0x04, 0xD0, 0x00,
+      0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00A4
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x74,
+      0x0A, 0xDE, 0xD1, 0x07, 0x73, 0xB0, 0x0A, 0xDE, 0xD1, 0x09, 0x00, 0x74,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00A5
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x98, 0x0B, 0x44, 0xB0,
+      0x8F, 0xDC, 0xF8, 0x00, 0xBB, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x99, 0x00,
+      0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00A6
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00,
+      0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00,
+      0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00},
+    // U+00A7
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xEF, 0xA0, 0x0B, 0x70, 0x00,
+      0x08, 0xD9, 0x10, 0x0D, 0x07, 0xD0, 0x0C, 0x91, 0xD0, 0x00, 0x7E, 0x80,
+      0x00, 0x07, 0xB0, 0x0B, 0xFE, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00A8
+    {0x00, 0x00, 0x00, 0x08, 0xA9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00A9
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x7D, 0xFF, 0xD8,
+      0xAB, 0x40, 0x0A, 0x9B, 0x40, 0x09, 0xA5, 0xEF, 0x5A, 0x7A, 0x22, 0xA8,
+      0x08, 0xEE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00AA
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x60, 0x06, 0xEF, 0xB0,
+      0x0B, 0x56, 0xB0, 0x07, 0xFA, 0xB0, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xC0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00AB
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0xA0, 0x92, 0x3C, 0x5B, 0x60, 0x3C, 0x5B, 0x60, 0x01, 0xA0, 0x92,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00AC
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00AD
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x60, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00AE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x7D, 0xFF, 0xC8,
+      0xA5, 0xFE, 0x2A, 0x95, 0x8B, 0x19, 0xA5, 0x86, 0x8A, 0x7A, 0x22, 0xA8,
+      0x08, 0xEE, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00AF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x90, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00B0
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEE, 0x40, 0x09, 0x66, 0x90,
+      0x04, 0xEE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00B1
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00,
+      0x00, 0x88, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00,
+      0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00B2
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x30, 0x00, 0x0A, 0x30,
+      0x00, 0x84, 0x00, 0x07, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00B3
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFE, 0x50, 0x00, 0xBE, 0x30,
+      0x00, 0x08, 0x80, 0x08, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00B4
+    {0x00, 0x00, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00B5
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x1E, 0x00, 0xD3, 0x1E, 0x00, 0xD3, 0x1E, 0x00, 0xD3, 0x1F, 0x33, 0xF3,
+      0x1D, 0xDE, 0xAC, 0x1D, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00B6
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF1, 0x7F, 0xF8, 0xB1,
+      0x7F, 0xF8, 0xB1, 0x0B, 0xF8, 0xB1, 0x00, 0x68, 0xB1, 0x00, 0x68, 0xB1,
+      0x00, 0x68, 0xB1, 0x00, 0x68, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00B7
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00B8
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00},
+    // U+00B9
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x59, 0x00,
+      0x00, 0x59, 0x00, 0x05, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00BA
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEE, 0x50, 0x0C, 0x43, 0xC0,
+      0x0C, 0x44, 0xC0, 0x05, 0xEE, 0x50, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xB0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00BB
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x1A, 0x0A, 0x20, 0x06, 0xB5, 0xC4, 0x06, 0xB5, 0xC4, 0x1A, 0x0A, 0x20,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00BC
+    {0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x09, 0x40, 0x00, 0x09, 0x40, 0x00,
+      0x9F, 0xF4, 0x00, 0x25, 0x8B, 0xE7, 0xDD, 0xA7, 0x40, 0x00, 0x06, 0xC0,
+      0x00, 0x34, 0xB0, 0x00, 0xCF, 0xF7, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00},
+    // U+00BD
+    {0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x09, 0x40, 0x00, 0x09, 0x40, 0x00,
+      0x9F, 0xF4, 0x00, 0x25, 0x8B, 0xE7, 0xDD, 0xA7, 0x40, 0x00, 0x8F, 0xE3,
+      0x00, 0x00, 0xA3, 0x00, 0x08, 0x40, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x00},
+    // U+00BE
+    {0x00, 0x00, 0x00, 0x7F, 0xE3, 0x00, 0x0C, 0xE1, 0x00, 0x00, 0xA6, 0x00,
+      0x9F, 0xD3, 0x00, 0x25, 0x8B, 0xE7, 0xDD, 0xA7, 0x40, 0x00, 0x06, 0xC0,
+      0x00, 0x34, 0xB0, 0x00, 0xCF, 0xF7, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x00},
+    // U+00BF
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0xA8, 0x00,
+      0x09, 0xB0, 0x00, 0x0F, 0x30, 0x00, 0x0A, 0xFF, 0xD0, 0x00, 0x00, 0x00},
+    // U+00C0
+    {0x00, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x02, 0xDC, 0x20,
+      0x07, 0x88, 0x80, 0x0C, 0x33, 0xC0, 0x1F, 0xFF, 0xF2, 0x7A, 0x00, 0xA7,
+      0xB7, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00C1
+    {0x00, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x02, 0xDC, 0x20,
+      0x07, 0x88, 0x80, 0x0C, 0x33, 0xC0, 0x1F, 0xFF, 0xF2, 0x7A, 0x00, 0xA7,
+      0xB7, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00C2
+    {0x03, 0xAA, 0x30, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x02, 0xDC, 0x20,
+      0x07, 0x88, 0x80, 0x0C, 0x33, 0xC0, 0x1F, 0xFF, 0xF2, 0x7A, 0x00, 0xA7,
+      0xB7, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00C3
+    {0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x02, 0xDC, 0x20,
+      0x07, 0x88, 0x80, 0x0C, 0x33, 0xC0, 0x1F, 0xFF, 0xF2, 0x7A, 0x00, 0xA7,
+      0xB7, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00C4
+    {0x08, 0xA9, 0x80, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x02, 0xDC, 0x20,
+      0x07, 0x88, 0x80, 0x0C, 0x33, 0xC0, 0x1F, 0xFF, 0xF2, 0x7A, 0x00, 0xA7,
+      0xB7, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00C5
+    {0x02, 0xEE, 0x20, 0x05, 0x99, 0x50, 0x00, 0xEE, 0x00, 0x02, 0xCC, 0x30,
+      0x08, 0x88, 0x80, 0x0C, 0x33, 0xC0, 0x1F, 0xFF, 0xF2, 0x7A, 0x00, 0xA7,
+      0xB7, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00C6
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0x08, 0x8E, 0x00,
+      0x0C, 0x2E, 0x00, 0x1C, 0x0E, 0xF9, 0x6F, 0xFF, 0x00, 0xA5, 0x0E, 0x00,
+      0xE1, 0x0E, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00C7
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xB0, 0x0E, 0x81, 0x74,
+      0x4E, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x0E, 0x81, 0x74,
+      0x04, 0xDF, 0xB0, 0x00, 0x08, 0x50, 0x00, 0xAF, 0x60, 0x00, 0x00, 0x00},
+    // U+00C8
+    {0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF6, 0x1F, 0x00, 0x00,
+      0x1F, 0x00, 0x00, 0x1F, 0xFF, 0xF3, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
+      0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00C9
+    {0x00, 0x4B, 0x10, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF6, 0x1F, 0x00, 0x00,
+      0x1F, 0x00, 0x00, 0x1F, 0xFF, 0xF3, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
+      0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00CA
+    {0x02, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF6, 0x1F, 0x00, 0x00,
+      0x1F, 0x00, 0x00, 0x1F, 0xFF, 0xF3, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
+      0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00CB
+    {0x07, 0xB8, 0xA0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF6, 0x1F, 0x00, 0x00,
+      0x1F, 0x00, 0x00, 0x1F, 0xFF, 0xF3, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
+      0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00CC
+    {0x00, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF1, 0x00, 0x99, 0x00,
+      0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00,
+      0x0F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00CD
+    {0x00, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF1, 0x00, 0x99, 0x00,
+      0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00,
+      0x0F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00CE
+    {0x03, 0xAA, 0x30, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF1, 0x00, 0x99, 0x00,
+      0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00,
+      0x0F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00CF
+    {0x08, 0xA9, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF1, 0x00, 0x99, 0x00,
+      0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00,
+      0x0F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00D0
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x40, 0x7B, 0x17, 0xE1,
+      0x7B, 0x00, 0xD5, 0xFF, 0xF0, 0xB7, 0x7B, 0x00, 0xD5, 0x7B, 0x17, 0xE1,
+      0x7F, 0xFC, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00D1
+    {0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x6F, 0x30, 0xB7, 0x6E, 0xA0, 0xB7,
+      0x6B, 0xD1, 0xB7, 0x6B, 0x88, 0xB7, 0x6B, 0x1D, 0xB7, 0x6B, 0x0A, 0xE7,
+      0x6B, 0x03, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00D2
+    {0x00, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x08, 0xEE, 0x80, 0x2F, 0x43, 0xE3,
+      0x6C, 0x00, 0xB7, 0x8B, 0x00, 0xA8, 0x6C, 0x00, 0xB7, 0x2F, 0x43, 0xE3,
+      0x08, 0xEE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00D3
+    {0x00, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x08, 0xEE, 0x80, 0x2F, 0x43, 0xE3,
+      0x6C, 0x00, 0xB7, 0x8B, 0x00, 0xA8, 0x6C, 0x00, 0xB7, 0x2F, 0x43, 0xE3,
+      0x08, 0xEE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00D4
+    {0x03, 0xAA, 0x30, 0x00, 0x00, 0x00, 0x08, 0xEE, 0x80, 0x2F, 0x43, 0xE3,
+      0x6C, 0x00, 0xB7, 0x8B, 0x00, 0xA8, 0x6C, 0x00, 0xB7, 0x2F, 0x43, 0xE3,
+      0x08, 0xEE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00D5
+    {0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xEE, 0x80, 0x2F, 0x43, 0xE3,
+      0x6C, 0x00, 0xB7, 0x8B, 0x00, 0xA8, 0x6C, 0x00, 0xB7, 0x2F, 0x43, 0xE3,
+      0x08, 0xEE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00D6
+    {0x08, 0xA9, 0x80, 0x00, 0x00, 0x00, 0x08, 0xEE, 0x80, 0x2F, 0x43, 0xE3,
+      0x6C, 0x00, 0xB7, 0x8B, 0x00, 0xA8, 0x6C, 0x00, 0xB7, 0x2F, 0x43, 0xE3,
+      0x08, 0xEE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00D7
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2B, 0x00, 0xB2, 0x09, 0xBB, 0x90, 0x00, 0xDD, 0x00, 0x09, 0xBB, 0x90,
+      0x2C, 0x00, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00D8
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0xEE, 0x7A, 0x3F, 0x44, 0xF4,
+      0x7C, 0x09, 0xD7, 0x8B, 0x87, 0xA8, 0x7E, 0x90, 0xB7, 0x4F, 0x43, 0xF3,
+      0xA7, 0xEE, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00D9
+    {0x00, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0xC6, 0x6C, 0x00, 0xC6,
+      0x6C, 0x00, 0xC6, 0x6C, 0x00, 0xC6, 0x5C, 0x00, 0xC6, 0x3E, 0x33, 0xE4,
+      0x08, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00DA
+    {0x00, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x00, 0xC6, 0x6C, 0x00, 0xC6,
+      0x6C, 0x00, 0xC6, 0x6C, 0x00, 0xC6, 0x5C, 0x00, 0xC6, 0x3E, 0x33, 0xE4,
+      0x08, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00DB
+    {0x03, 0xAA, 0x30, 0x00, 0x00, 0x00, 0x6C, 0x00, 0xC6, 0x6C, 0x00, 0xC6,
+      0x6C, 0x00, 0xC6, 0x6C, 0x00, 0xC6, 0x5C, 0x00, 0xC6, 0x3E, 0x33, 0xE4,
+      0x08, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00DC
+    {0x08, 0xA9, 0x80, 0x00, 0x00, 0x00, 0x6C, 0x00, 0xC6, 0x6C, 0x00, 0xC6,
+      0x6C, 0x00, 0xC6, 0x6C, 0x00, 0xC6, 0x5C, 0x00, 0xC6, 0x3E, 0x33, 0xE4,
+      0x08, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00DD
+    {0x00, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x9A, 0x1E, 0x33, 0xE1,
+      0x06, 0xBB, 0x60, 0x00, 0xCC, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x00,
+      0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00DE
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xFF, 0xD3,
+      0x0F, 0x01, 0xAA, 0x0F, 0x01, 0xAA, 0x0F, 0xFF, 0xD3, 0x0F, 0x00, 0x00,
+      0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00DF
+    {0x00, 0x00, 0x00, 0x07, 0xEE, 0x60, 0x0E, 0x33, 0xE0, 0x2D, 0x1A, 0x90,
+      0x2D, 0x79, 0x00, 0x2D, 0x3E, 0x60, 0x2D, 0x03, 0xC6, 0x2D, 0x00, 0x9A,
+      0x2D, 0xDF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00E0
+    {0x00, 0x00, 0x00, 0x05, 0xB0, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00,
+      0x0F, 0xFE, 0x80, 0x00, 0x02, 0xE2, 0x1B, 0xFF, 0xF4, 0x6C, 0x23, 0xE4,
+      0x2D, 0xFC, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00E1
+    {0x00, 0x00, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+      0x0F, 0xFE, 0x80, 0x00, 0x02, 0xE2, 0x1B, 0xFF, 0xF4, 0x6C, 0x23, 0xE4,
+      0x2D, 0xFC, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00E2
+    {0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x05, 0x98, 0x60, 0x00, 0x00, 0x00,
+      0x0F, 0xFE, 0x80, 0x00, 0x02, 0xE2, 0x1B, 0xFF, 0xF4, 0x6C, 0x23, 0xE4,
+      0x2D, 0xFC, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00E3
+    {0x00, 0x00, 0x00, 0x06, 0xE4, 0xA0, 0x0A, 0x4E, 0x60, 0x00, 0x00, 0x00,
+      0x0F, 0xFE, 0x80, 0x00, 0x02, 0xE2, 0x1B, 0xFF, 0xF4, 0x6C, 0x23, 0xE4,
+      0x2D, 0xFC, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00E4
+    {0x00, 0x00, 0x00, 0x08, 0xA9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0F, 0xFE, 0x80, 0x00, 0x02, 0xE2, 0x1B, 0xFF, 0xF4, 0x6C, 0x23, 0xE4,
+      0x2D, 0xFC, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00E5
+    {0x01, 0xDD, 0x20, 0x06, 0x99, 0x60, 0x02, 0xDD, 0x20, 0x00, 0x00, 0x00,
+      0x0F, 0xFE, 0x80, 0x00, 0x02, 0xE2, 0x1B, 0xFF, 0xF4, 0x6C, 0x23, 0xE4,
+      0x2D, 0xFC, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00E6
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x9F, 0xDC, 0xF7, 0x00, 0x9B, 0x3D, 0x7E, 0xFF, 0xFE, 0xC5, 0x8B, 0x00,
+      0x8F, 0xB9, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00E7
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x04, 0xDF, 0xF4, 0x0D, 0x71, 0x00, 0x0F, 0x00, 0x00, 0x0D, 0x70, 0x00,
+      0x04, 0xDF, 0xF4, 0x00, 0x07, 0x50, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00},
+    // U+00E8
+    {0x00, 0x00, 0x00, 0x05, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+      0x08, 0xEF, 0xA0, 0x4D, 0x31, 0xC5, 0x7F, 0xFF, 0xF8, 0x4D, 0x20, 0x00,
+      0x08, 0xEF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00E9
+    {0x00, 0x00, 0x00, 0x00, 0x0A, 0x60, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00,
+      0x08, 0xEF, 0xA0, 0x4D, 0x31, 0xC5, 0x7F, 0xFF, 0xF8, 0x4D, 0x20, 0x00,
+      0x08, 0xEF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00EA
+    {0x00, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x04, 0x97, 0x70, 0x00, 0x00, 0x00,
+      0x08, 0xEF, 0xA0, 0x4D, 0x31, 0xC5, 0x7F, 0xFF, 0xF8, 0x4D, 0x20, 0x00,
+      0x08, 0xEF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00EB
+    {0x00, 0x00, 0x00, 0x07, 0xB9, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x08, 0xEF, 0xA0, 0x4D, 0x31, 0xC5, 0x7F, 0xFF, 0xF8, 0x4D, 0x20, 0x00,
+      0x08, 0xEF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00EC
+    {0x00, 0x00, 0x00, 0x05, 0xB0, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00,
+      0x0C, 0xFA, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x7A, 0x00,
+      0x3F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00ED
+    {0x00, 0x00, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+      0x0C, 0xFA, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x7A, 0x00,
+      0x3F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00EE
+    {0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x05, 0x98, 0x60, 0x00, 0x00, 0x00,
+      0x0C, 0xFA, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x7A, 0x00,
+      0x3F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00EF
+    {0x00, 0x00, 0x00, 0x06, 0xB8, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0C, 0xFA, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x7A, 0x00,
+      0x3F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00F0
+    {0x00, 0x00, 0x00, 0x05, 0xD5, 0x70, 0x06, 0xED, 0x20, 0x05, 0x2E, 0x60,
+      0x08, 0xEF, 0xE0, 0x3E, 0x31, 0xE5, 0x6B, 0x00, 0xB6, 0x3E, 0x33, 0xE3,
+      0x08, 0xEE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00F1
+    {0x00, 0x00, 0x00, 0x06, 0xE4, 0xA0, 0x0A, 0x4E, 0x60, 0x00, 0x00, 0x00,
+      0x1E, 0xBF, 0xA0, 0x1F, 0x52, 0xE1, 0x1E, 0x00, 0xD3, 0x1E, 0x00, 0xD3,
+      0x1E, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00F2
+    {0x00, 0x00, 0x00, 0x05, 0xB0, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00,
+      0x09, 0xEF, 0x90, 0x3E, 0x33, 0xE4, 0x6B, 0x00, 0xB6, 0x3E, 0x33, 0xE4,
+      0x09, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00F3
+    {0x00, 0x00, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+      0x09, 0xEF, 0x90, 0x3E, 0x33, 0xE4, 0x6B, 0x00, 0xB6, 0x3E, 0x33, 0xE4,
+      0x09, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00F4
+    {0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x05, 0x98, 0x60, 0x00, 0x00, 0x00,
+      0x09, 0xEF, 0x90, 0x3E, 0x33, 0xE4, 0x6B, 0x00, 0xB6, 0x3E, 0x33, 0xE4,
+      0x09, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00F5
+    {0x00, 0x00, 0x00, 0x06, 0xE4, 0xA0, 0x0A, 0x4E, 0x60, 0x00, 0x00, 0x00,
+      0x09, 0xEF, 0x90, 0x3E, 0x33, 0xE4, 0x6B, 0x00, 0xB6, 0x3E, 0x33, 0xE4,
+      0x09, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00F6
+    {0x00, 0x00, 0x00, 0x08, 0xA9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x09, 0xEF, 0x90, 0x3E, 0x33, 0xE4, 0x6B, 0x00, 0xB6, 0x3E, 0x33, 0xE4,
+      0x09, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00F7
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x00,
+      0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00F8
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+      0x09, 0xFE, 0xA8, 0x4E, 0x37, 0xF3, 0x6B, 0x77, 0xB6, 0x2F, 0x73, 0xE4,
+      0x89, 0xEF, 0x90, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00F9
+    {0x00, 0x00, 0x00, 0x05, 0xB0, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00,
+      0x1E, 0x00, 0xD3, 0x1E, 0x00, 0xD3, 0x1E, 0x00, 0xD3, 0x0E, 0x34, 0xF3,
+      0x09, 0xFC, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00FA
+    {0x00, 0x00, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+      0x1E, 0x00, 0xD3, 0x1E, 0x00, 0xD3, 0x1E, 0x00, 0xD3, 0x0E, 0x34, 0xF3,
+      0x09, 0xFC, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00FB
+    {0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x05, 0x98, 0x60, 0x00, 0x00, 0x00,
+      0x1E, 0x00, 0xD3, 0x1E, 0x00, 0xD3, 0x1E, 0x00, 0xD3, 0x0E, 0x34, 0xF3,
+      0x09, 0xFC, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00FC
+    {0x00, 0x00, 0x00, 0x08, 0xA9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x1E, 0x00, 0xD3, 0x1E, 0x00, 0xD3, 0x1E, 0x00, 0xD3, 0x0E, 0x34, 0xF3,
+      0x09, 0xFC, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00FD
+    {0x00, 0x00, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+      0x5B, 0x00, 0xA8, 0x0D, 0x20, 0xE1, 0x07, 0x97, 0x90, 0x00, 0xDD, 0x30,
+      0x00, 0x9C, 0x00, 0x01, 0xD6, 0x00, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x00},
+    // U+00FE
+    {0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00,
+      0x2E, 0xCF, 0xA0, 0x2F, 0x52, 0xD5, 0x2E, 0x00, 0xA7, 0x2F, 0x42, 0xD5,
+      0x2E, 0xCF, 0xA0, 0x2D, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+00FF
+    {0x00, 0x00, 0x00, 0x08, 0xA9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x5B, 0x00, 0xA8, 0x0D, 0x20, 0xE1, 0x07, 0x97, 0x90, 0x00, 0xDD, 0x30,
+      0x00, 0x9C, 0x00, 0x01, 0xD6, 0x00, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x00},
+    // U+03C0
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x99, 0x96,
+      0x5F, 0x88, 0xF5, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
+      0x0E, 0x00, 0xD9, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+2260
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x00, 0x03, 0xD1,
+      0xAF, 0xFF, 0xFA, 0x00, 0x99, 0x00, 0xAF, 0xFF, 0xFA, 0x1E, 0x30, 0x00,
+      0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+2264
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x27, 0xB9, 0x6C, 0xC9, 0x40, 0x6C, 0xC9, 0x40, 0x00, 0x27, 0xB9,
+      0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+2265
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x9B, 0x72, 0x00, 0x04, 0x9C, 0xC6, 0x04, 0x9C, 0xC6, 0x9B, 0x72, 0x00,
+      0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+23BA
+    {0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+23BB
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+23BC
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+23BD
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF},
+    // U+2500
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+2502
+    {0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+      0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+      0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00},
+    // U+250C
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+      0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00},
+    // U+2510
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+      0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00},
+    // U+2514
+    {0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+      0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+2518
+    {0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+      0x00, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+251C
+    {0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+      0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+      0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00},
+    // U+2524
+    {0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+      0x00, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+      0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00},
+    // U+252C
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+      0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00},
+    // U+2534
+    {0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+      0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+253C
+    {0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+      0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+      0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00},
+    // U+2580
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    // U+2584
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+    // U+2588
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+    // U+2591
+    {0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00,
+      0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00,
+      0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00},
+    // U+2592
+    {0xF0, 0xF0, 0xF0, 0x0F, 0x0F, 0x0F, 0xF0, 0xF0, 0xF0, 0x0F, 0x0F, 0x0F,
+      0xF0, 0xF0, 0xF0, 0x0F, 0x0F, 0x0F, 0xF0, 0xF0, 0xF0, 0x0F, 0x0F, 0x0F,
+      0xF0, 0xF0, 0xF0, 0x0F, 0x0F, 0x0F, 0xF0, 0xF0, 0xF0, 0x0F, 0x0F, 0x0F},
+    // U+2593
+    {0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+      0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0,
+      0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0},
+    // U+25C6
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00,
+      0x04, 0xEE, 0x40, 0x4E, 0xFF, 0xE4, 0xCF, 0xFF, 0xFC, 0x2D, 0xFF, 0xD2,
+      0x02, 0xDD, 0x20, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+};
+
+const TermFont term_font_6x12 = {TERM_FONT_WIDTH, TERM_FONT_HEIGHT, 216,
+                                  codepoints, &coverage[0][0]};
@@ -0,0 +1,537 @@
+/**
+ * TerminalGrid - cell array and dirty-row bookkeeping for the SSH terminal
+ */
+
+#include "TerminalGrid.h"
+#include "Scrollback.h"
+#include <stdlib.h>
+#include <string.h>
+
+TerminalGrid::TerminalGrid() {
+  reset_pen();
+  memset(_map, 0, sizeof(_map));
+  memset(_dirty, 0, sizeof(_dirty));
+  reset_saved_cursor();
+  reset_tabs();
+}
+
+TerminalGrid::~TerminalGrid() {
+  free(_buf[0]);
+  free(_buf[1]);
+}
+
+bool TerminalGrid::resize(uint16_t cols, uint16_t rows) {
+  if (cols == 0 || rows == 0)
+    return false;
+  if (cols > TERM_MAX_COLS)
+    cols = TERM_MAX_COLS;
+  if (rows > TERM_MAX_ROWS)
+    rows = TERM_MAX_ROWS;
+
+  if (cols != _cols || rows != _rows || !_buf[0]) {
+    size_t bytes = sizeof(TermCell) * cols * rows;
+    TermCell *main_buf = (TermCell *)malloc(bytes);
+    TermCell *alt_buf = (TermCell *)malloc(bytes);
+    if (!main_buf || !alt_buf) {
+      free(main_buf);
+      free(alt_buf);
+      return false;
+    }
+    free(_buf[0]);
+    free(_buf[1]);
+    _buf[0] = main_buf;
+    _buf[1] = alt_buf;
+    _cols = cols;
+    _rows = rows;
+  }
+
+  _active = 1;
+  clear();
+  _active = 0;
+  clear();
+  return true;
+}
+
+const TermCell *TerminalGrid::row(uint16_t r) const {
+  if (!_buf[_active] || r >= _rows)
+    return nullptr;
+  return &_buf[_active][_map[_active][r] * _cols];
+}
+
+void TerminalGrid::reset_pen() {
+  pen.glyph = ' ';
+  pen.fg = 7;
+  pen.bg = 0;
+  pen.flags = TERM_ATTR_DEFAULT_FG | TERM_ATTR_DEFAULT_BG;
+}
+
+void TerminalGrid::reset_tabs() {
+  memset(_tabs, 0, sizeof(_tabs));
+  for (uint16_t c = 8; c < TERM_MAX_COLS; c += 8)
+    _tabs[c >> 5] |= 1u << (c & 31);
+}
+
+void TerminalGrid::blank(TermCell *from, size_t count) {
+  // Erased cells take the current background (xterm "bce")
+  TermCell b;
+  b.glyph = ' ';
+  b.fg = pen.fg;
+  b.bg = pen.bg;
+  b.flags = pen.flags & (TERM_ATTR_DEFAULT_FG | TERM_ATTR_DEFAULT_BG);
+  for (size_t i = 0; i < count; i++)
+    from[i] = b;
+}
+
+void TerminalGrid::clear() {
+  if (!_buf[_active])
+    return;
+  for (uint16_t r = 0; r < _rows; r++)
+    _map[_active][r] = r;
+  blank(_buf[_active], (size_t)_cols * _rows);
+  _cur_row = 0;
+  _cur_col = 0;
+  _wrap_pending = false;
+  _top = 0;
+  _bottom = _rows - 1;
+  mark_all_dirty();
+}
+
+void TerminalGrid::fill_test_pattern() {
+  for (uint16_t r = 0; r < _rows; r++) {
+    TermCell *line = cell_at(r, 0);
+    for (uint16_t c = 0; c < _cols; c++) {
+      line[c] = pen;
+      line[c].glyph = 'E';
+    }
+  }
+  mark_all_dirty();
+}
+
+void TerminalGrid::put(uint32_t cp) {
+  if (!_buf[_active])
+    return;
+
+  if (_wrap_pending) {
+    carriage_return();
+    line_feed();
+  }
+
+  if (insert_mode)
+    insert_chars(1);
+
+  TermCell *cell = cell_at(_cur_row, _cur_col);
+  *cell = pen;
+  cell->glyph = cp > 0xFFFF ? '?' : (uint16_t)cp;
+  mark_dirty(_cur_row);
+
+  if (_cur_col + 1 >= _cols) {
+    // Defer wrap until the next printable (xterm semantics)
+    _wrap_pending = autowrap;
+  } else {
+    _cur_col++;
+  }
+}
+
+void TerminalGrid::move_to(int row, int col) {
+  int min_row = 0, max_row = _rows - 1;
+  if (origin_mode) {
+    row += _top;
+    min_row = _top;
+    max_row = _bottom;
+  }
+  if (row < min_row)
+    row = min_row;
+  if (row > max_row)
+    row = max_row;
+  if (col < 0)
+    col = 0;
+  if (col >= _cols)
+    col = _cols - 1;
+  _cur_row = row;
+  _cur_col = col;
+  _wrap_pending = false;
+}
+
+void TerminalGrid::move_rel(int drow, int dcol) {
+  int row = _cur_row + drow;
+  int col = _cur_col + dcol;
+
+  // Vertical moves stop at the margins when starting inside them
+  if (_cur_row >= _top && _cur_row <= _bottom) {
+    if (row < _top)
+      row = _top;
+    if (row > _bottom)
+      row = _bottom;
+  }
+  if (row < 0)
+    row = 0;
+  if (row >= _rows)
+    row = _rows - 1;
+  if (col < 0)
+    col = 0;
+  if (col >= _cols)
+    col = _cols - 1;
+  _cur_row = row;
+  _cur_col = col;
+  _wrap_pending = false;
+}
+
+void TerminalGrid::set_cursor_visible(bool on) {
+  if (_cursor_visible != on) {
+    _cursor_visible = on;
+    mark_dirty(_cur_row);
+  }
+}
+
+void TerminalGrid::save_cursor() {
+  SavedCursor &s = _saved[_active];
+  s.row = _cur_row;
+  s.col = _cur_col;
+  s.pen = pen;
+  s.origin_mode = origin_mode;
+}
+
+void TerminalGrid::reset_saved_cursor() {
+  for (int i = 0; i < 2; i++) {
+    _saved[i].row = 0;
+    _saved[i].col = 0;
+    _saved[i].pen = pen;
+    _saved[i].origin_mode = false;
+  }
+}
+
+void TerminalGrid::restore_cursor() {
+  const SavedCursor &s = _saved[_active];
+  _cur_row = s.row < _rows ? s.row : _rows - 1;
+  _cur_col = s.col < _cols ? s.col : _cols - 1;
+  pen = s.pen;
+  origin_mode = s.origin_mode;
+  _wrap_pending = false;
+}
+
+void TerminalGrid::line_feed() {
+  _wrap_pending = false;
+  if (_cur_row == _bottom) {
+    scroll_up(1);
+  } else if (_cur_row + 1 < _rows) {
+    _cur_row++;
+  }
+}
+
+void TerminalGrid::reverse_index() {
+  _wrap_pending = false;
+  if (_cur_row == _top) {
+    scroll_down(1);
+  } else if (_cur_row > 0) {
+    _cur_row--;
+  }
+}
+
+void TerminalGrid::backspace() {
+  _wrap_pending = false;
+  if (_cur_col > 0)
+    _cur_col--;
+}
+
+void TerminalGrid::tab(int n) {
+  _wrap_pending = false;
+  while (n-- > 0 && _cur_col + 1 < _cols) {
+    do {
+      _cur_col++;
+    } while (_cur_col + 1 < _cols &&
+             !((_tabs[_cur_col >> 5] >> (_cur_col & 31)) & 1u));
+  }
+}
+
+void TerminalGrid::back_tab(int n) {
+  _wrap_pending = false;
+  while (n-- > 0 && _cur_col > 0) {
+    do {
+      _cur_col--;
+    } while (_cur_col > 0 && !((_tabs[_cur_col >> 5] >> (_cur_col & 31)) & 1u));
+  }
+}
+
+void TerminalGrid::set_tab_stop() {
+  _tabs[_cur_col >> 5] |= 1u << (_cur_col & 31);
+}
+
+void TerminalGrid::clear_tab_stop(bool all) {
+  if (all)
+    memset(_tabs, 0, sizeof(_tabs));
+  else
+    _tabs[_cur_col >> 5] &= ~(1u << (_cur_col & 31));
+}
+
+void TerminalGrid::mark_range(uint16_t top, uint16_t bottom) {
+  for (uint16_t r = top; r <= bottom && r < _rows; r++)
+    mark_dirty(r);
+}
+
+void TerminalGrid::rotate_up(uint16_t top, uint16_t bottom, int n) {
+  int span = bottom - top + 1;
+  if (n <= 0 || span <= 0)
+    return;
+  if (n > span)
+    n = span;
+
+  // Rotate the row map so rows [top, top+n) become the new bottom rows
+  uint8_t *map = _map[_active];
+  uint8_t saved[TERM_MAX_ROWS];
+  memcpy(saved, map + top, n);
+  memmove(map + top, map + top + n, span - n);
+  memcpy(map + bottom - n + 1, saved, n);
+
+  for (int r = bottom - n + 1; r <= bottom; r++)
+    blank(cell_at(r, 0), _cols);
+  mark_range(top, bottom);
+}
+
+void TerminalGrid::rotate_down(uint16_t top, uint16_t bottom, int n) {
+  int span = bottom - top + 1;
+  if (n <= 0 || span <= 0)
+    return;
+  if (n > span)
+    n = span;
+
+  uint8_t *map = _map[_active];
+  uint8_t saved[TERM_MAX_ROWS];
+  memcpy(saved, map + bottom - n + 1, n);
+  memmove(map + top + n, map + top, span - n);
+  memcpy(map + top, saved, n);
+
+  for (int r = top; r < top + n; r++)
+    blank(cell_at(r, 0), _cols);
+  mark_range(top, bottom);
+}
+
+void TerminalGrid::scroll_up(int n) {
+  if (!_buf[_active])
+    return;
+  // Lines scrolled off the top of the main screen go to history; rows
+  // removed by DL are gone, as in xterm
+  if (_scrollback && _active == 0 && _top == 0) {
+    int span = _bottom - _top + 1;
+    for (int r = 0; r < n && r < span; r++)
+      _scrollback->push(row(r), _cols);
+  }
+  rotate_up(_top, _bottom, n);
+}
+
+void TerminalGrid::scroll_down(int n) {
+  if (_buf[_active])
+    rotate_down(_top, _bottom, n);
+}
+
+void TerminalGrid::insert_lines(int n) {
+  if (!_buf[_active] || _cur_row < _top || _cur_row > _bottom)
+    return;
+  rotate_down(_cur_row, _bottom, n);
+  _cur_col = 0;
+  _wrap_pending = false;
+}
+
+void TerminalGrid::delete_lines(int n) {
+  if (!_buf[_active] || _cur_row < _top || _cur_row > _bottom)
+    return;
+  rotate_up(_cur_row, _bottom, n);
+  _cur_col = 0;
+  _wrap_pending = false;
+}
+
+void TerminalGrid::set_scroll_region(int top, int bottom) {
+  if (top < 0)
+    top = 0;
+  if (bottom >= _rows || bottom < 0)
+    bottom = _rows - 1;
+  if (top >= bottom)
+    return;
+  _top = top;
+  _bottom = bottom;
+  move_to(0, 0); // DECSTBM homes the cursor
+}
+
+void TerminalGrid::erase_chars(int n) {
+  if (!_buf[_active])
+    return;
+  if (n > _cols - _cur_col)
+    n = _cols - _cur_col;
+  blank(cell_at(_cur_row, _cur_col), n);
+  _wrap_pending = false;
+  mark_dirty(_cur_row);
+}
+
+void TerminalGrid::insert_chars(int n) {
+  if (!_buf[_active])
+    return;
+  int avail = _cols - _cur_col;
+  if (n > avail)
+    n = avail;
+  TermCell *at = cell_at(_cur_row, _cur_col);
+  memmove(at + n, at, sizeof(TermCell) * (avail - n));
+  blank(at, n);
+  mark_dirty(_cur_row);
+}
+
+void TerminalGrid::delete_chars(int n) {
+  if (!_buf[_active])
+    return;
+  int avail = _cols - _cur_col;
+  if (n > avail)
+    n = avail;
+  TermCell *at = cell_at(_cur_row, _cur_col);
+  memmove(at, at + n, sizeof(TermCell) * (avail - n));
+  blank(at + avail - n, n);
+  _wrap_pending = false;
+  mark_dirty(_cur_row);
+}
+
+void TerminalGrid::erase_in_line(int mode) {
+  if (!_buf[_active])
+    return;
+  TermCell *line = cell_at(_cur_row, 0);
+  if (mode == 0)
+    blank(line + _cur_col, _cols - _cur_col);
+  else if (mode == 1)
+    blank(line, _cur_col + 1);
+  else
+    blank(line, _cols);
+  _wrap_pending = false;
+  mark_dirty(_cur_row);
+}
+
+void TerminalGrid::erase_in_display(int mode) {
+  if (!_buf[_active])
+    return;
+  if (mode == 0) {
+    erase_in_line(0);
+    for (uint16_t r = _cur_row + 1; r < _rows; r++) {
+      blank(cell_at(r, 0), _cols);
+      mark_dirty(r);
+    }
+  } else if (mode == 1) {
+    erase_in_line(1);
+    for (uint16_t r = 0; r < _cur_row; r++) {
+      blank(cell_at(r, 0), _cols);
+      mark_dirty(r);
+    }
+  } else if (mode == 2) {
+    for (uint16_t r = 0; r < _rows; r++)
+      blank(cell_at(r, 0), _cols);
+    mark_all_dirty();
+  } else if (mode == 3 && _scrollback) {
+    _scrollback->clear(); // xterm "erase saved lines"
+  }
+}
+
+void TerminalGrid::use_alt_screen(bool alt) {
+  uint8_t want = alt ? 1 : 0;
+  if (want == _active || !_buf[want])
+    return;
+  _active = want;
+  if (alt) {
+    // The alternate screen always starts blank
+    for (uint16_t r = 0; r < _rows; r++)
+      _map[1][r] = r;
+    blank(_buf[1], (size_t)_cols * _rows);
+  }
+  _wrap_pending = false;
+  mark_all_dirty();
+}
+
+void TerminalGrid::begin_local() {
+  LocalSave &l = _local;
+  l.active = _active;
+  l.row = _cur_row;
+  l.col = _cur_col;
+  l.wrap_pending = _wrap_pending;
+  l.top = _top;
+  l.bottom = _bottom;
+  l.pen = pen;
+  l.autowrap = autowrap;
+  l.insert_mode = insert_mode;
+  l.origin_mode = origin_mode;
+
+  if (_active) {
+    // Continue the main screen where the host left it (DECSC by 1049)
+    _active = 0;
+    _cur_row = _saved[0].row < _rows ? _saved[0].row : _rows - 1;
+    _cur_col = _saved[0].col < _cols ? _saved[0].col : _cols - 1;
+    _wrap_pending = false;
+  }
+  _top = 0;
+  _bottom = _rows ? _rows - 1 : 0;
+  reset_pen();
+  autowrap = true;
+  insert_mode = false;
+  origin_mode = false;
+}
+
+void TerminalGrid::end_local() {
+  const LocalSave &l = _local;
+  if (l.active) {
+    // Leaving the alternate screen restores the cursor after the text
+    _saved[0].row = _cur_row;
+    _saved[0].col = _cur_col;
+    _active = l.active;
+    _cur_row = l.row;
+    _cur_col = l.col;
+    _wrap_pending = l.wrap_pending;
+  }
+  _top = l.top;
+  _bottom = l.bottom;
+  pen = l.pen;
+  autowrap = l.autowrap;
+  insert_mode = l.insert_mode;
+  origin_mode = l.origin_mode;
+}
+
+bool TerminalGrid::any_dirty() const {
+  for (size_t i = 0; i < sizeof(_dirty) / sizeof(_dirty[0]); i++) {
+    if (_dirty[i])
+      return true;
+  }
+  return false;
+}
+
+void TerminalGrid::mark_all_dirty() {
+  for (uint16_t r = 0; r < _rows; r++)
+    mark_dirty(r);
+}
+
+void TerminalGrid::clear_dirty() { memset(_dirty, 0, sizeof(_dirty)); }
+
+size_t TerminalGrid::snapshot_text(char *out, size_t max) const {
+  if (!out || max == 0)
+    return 0;
+
+  size_t n = 0;
+  const TermCell *main_buf = _buf[0];
+  for (uint16_t r = 0; r < _rows && main_buf; r++) {
+    const TermCell *line = &main_buf[_map[0][r] * _cols];
+    int end = _cols;
+    while (end > 0 && line[end - 1].glyph == ' ')
+      end--;
+    for (int c = 0; c < end && n + 4 < max; c++) {
+      uint16_t g = line[c].glyph;
+      if (g < 0x80) {
+        out[n++] = (char)g;
+      } else if (g < 0x800) {
+        out[n++] = (char)(0xC0 | (g >> 6));
+        out[n++] = (char)(0x80 | (g & 0x3F));
+      } else {
+        out[n++] = (char)(0xE0 | (g >> 12));
+        out[n++] = (char)(0x80 | ((g >> 6) & 0x3F));
+        out[n++] = (char)(0x80 | (g & 0x3F));
+      }
+    }
+    if (r + 1 < _rows && n + 1 < max)
+      out[n++] = '\n';
+  }
+
+  // Drop trailing blank lines
+  while (n > 0 && out[n - 1] == '\n')
+    n--;
+  out[n] = '\0';
+  return n;
+}
@@ -0,0 +1,176 @@
+#ifndef TERMINAL_GRID_H
+#define TERMINAL_GRID_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * TerminalGrid
+ * Fixed-size rows x cols cell array backing the terminal view. Each cell
+ * stores one glyph plus its colour/attribute byte, and every row touched
+ * since the last repaint is recorded in a dirty bitmap so the view only
+ * redraws what actually changed.
+ *
+ * Rows are addressed through an indirection table, so scrolling rotates
+ * row indices instead of moving cell memory. The grid is the screen model
+ * driven by VTParser: cursor, margins, erase/insert/delete and the xterm
+ * alternate screen all live here.
+ */
+
+class Scrollback;
+
+#define TERM_MAX_COLS 160
+#define TERM_MAX_ROWS 64
+
+// Cell attribute flags
+#define TERM_ATTR_BOLD 0x01
+#define TERM_ATTR_DIM 0x02
+#define TERM_ATTR_UNDERLINE 0x04
+#define TERM_ATTR_INVERSE 0x08
+#define TERM_ATTR_HIDDEN 0x10
+#define TERM_ATTR_DEFAULT_FG 0x20 // fg ignored, use theme colour
+#define TERM_ATTR_DEFAULT_BG 0x40 // bg ignored, transparent
+
+struct TermCell {
+  uint16_t glyph; // Unicode BMP code point, ' ' for blank
+  uint8_t fg;     // xterm-256 palette index
+  uint8_t bg;     // xterm-256 palette index
+  uint8_t flags;  // TERM_ATTR_*
+};
+
+class TerminalGrid {
+public:
+  TerminalGrid();
+  ~TerminalGrid();
+
+  // (Re)allocate the cell arrays. Contents are cleared.
+  bool resize(uint16_t cols, uint16_t rows);
+  uint16_t cols() const { return _cols; }
+  uint16_t rows() const { return _rows; }
+
+  // Row access for the renderer (visual row index, top = 0)
+  const TermCell *row(uint16_t r) const;
+
+  // Output a printable code point at the cursor (honours wrap/insert mode)
+  void put(uint32_t cp);
+
+  // Cursor
+  void move_to(int row, int col); // Absolute, honours origin mode
+  void move_rel(int drow, int dcol);
+  uint16_t cursor_row() const { return _cur_row; }
+  uint16_t cursor_col() const { return _cur_col; }
+  bool cursor_visible() const { return _cursor_visible; }
+  void set_cursor_visible(bool on);
+  void save_cursor();
+  void restore_cursor();
+  // DECRC without a DECSC homes with the default pen, on either screen
+  void reset_saved_cursor();
+
+  // Line movement (IND/RI/NEL semantics, scrolling inside the margins)
+  void line_feed();
+  void reverse_index();
+  void carriage_return() {
+    _cur_col = 0;
+    _wrap_pending = false;
+  }
+  void backspace();
+  void tab(int n = 1);
+  void back_tab(int n = 1);
+  void set_tab_stop();
+  void clear_tab_stop(bool all);
+
+  // Erase (modes follow ECMA-48: 0 = to end, 1 = to start, 2 = all)
+  void erase_in_line(int mode);
+  void erase_in_display(int mode);
+  void erase_chars(int n);
+  void insert_chars(int n);
+  void delete_chars(int n);
+  void insert_lines(int n);
+  void delete_lines(int n);
+  void scroll_up(int n);
+  void scroll_down(int n);
+  void set_scroll_region(int top, int bottom); // 0-based, inclusive
+  uint16_t scroll_top() const { return _top; }
+  uint16_t scroll_bottom() const { return _bottom; }
+  void clear();
+  void fill_test_pattern(); // DECALN
+
+  // Modes
+  bool autowrap = true;
+  bool insert_mode = false;
+  bool origin_mode = false;
+  // LNM (CSI 20 h): LF also returns the carriage. Host state only.
+  bool newline_mode = false;
+  void use_alt_screen(bool alt);
+  bool in_alt_screen() const { return _active == 1; }
+
+  // Local (non-host) output goes between these: main screen, default pen,
+  // full margins, autowrap on. The host's pen, margins and modes are put
+  // back after, and on the alternate screen so is its cursor.
+  void begin_local();
+  void end_local();
+
+  // Current drawing attributes applied to newly written cells
+  TermCell pen;
+  void reset_pen();
+
+  // Dirty-row tracking
+  bool is_dirty(uint16_t r) const {
+    return (_dirty[r >> 5] >> (r & 31)) & 1u;
+  }
+  bool any_dirty() const;
+  void mark_dirty(uint16_t r) { _dirty[r >> 5] |= 1u << (r & 31); }
+  void mark_all_dirty();
+  void clear_dirty();
+
+  // Rows scrolled off the top of the main screen are appended here
+  void set_scrollback(Scrollback *sb) { _scrollback = sb; }
+  Scrollback *scrollback() const { return _scrollback; }
+
+  // Copy visible text (trailing blanks trimmed) for session persistence
+  size_t snapshot_text(char *out, size_t max) const;
+
+private:
+  // Main and alternate screens, each with its own row map
+  TermCell *_buf[2] = {nullptr, nullptr};
+  uint8_t _map[2][TERM_MAX_ROWS];
+  uint8_t _active = 0;
+  uint16_t _cols = 0;
+  uint16_t _rows = 0;
+  uint32_t _dirty[(TERM_MAX_ROWS + 31) / 32];
+  uint32_t _tabs[(TERM_MAX_COLS + 31) / 32];
+
+  uint16_t _cur_row = 0;
+  uint16_t _cur_col = 0;
+  bool _wrap_pending = false;
+  bool _cursor_visible = true;
+  uint16_t _top = 0;
+  uint16_t _bottom = 0;
+  Scrollback *_scrollback = nullptr;
+
+  struct SavedCursor {
+    uint16_t row, col;
+    TermCell pen;
+    bool origin_mode;
+  } _saved[2];
+
+  struct LocalSave {
+    uint8_t active;
+    uint16_t row, col;
+    bool wrap_pending;
+    uint16_t top, bottom;
+    TermCell pen;
+    bool autowrap, insert_mode, origin_mode;
+  } _local;
+
+  TermCell *cell_at(uint16_t r, uint16_t c) {
+    return &_buf[_active][_map[_active][r] * _cols + c];
+  }
+  void blank(TermCell *from, size_t count);
+  void rotate_up(uint16_t top, uint16_t bottom, int n);
+  void rotate_down(uint16_t top, uint16_t bottom, int n);
+  void mark_range(uint16_t top, uint16_t bottom);
+  void reset_tabs();
+};
+
+#endif // TERMINAL_GRID_H
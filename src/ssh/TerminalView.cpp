@@ -0,0 +1,437 @@
+/**
+ * TerminalView - LVGL draw object for the terminal cell grid
+ */
+
+#include "TerminalView.h"
+#include "ScrollbackSearch.h"
+#include <esp_heap_caps.h>
+#include <string.h>
+
+// Base 16 colours, tuned to the cyberpunk theme
+static const uint32_t base_palette[16] = {
+    0x000000, 0xFF3333, 0x00FF66, 0xFFFF00, 0x3366FF, 0xFF33FF,
+    0x33FFFF, 0xC0C0C0, 0x665500, 0xFF6666, 0x66FF99, 0xFFFF66,
+    0x6699FF, 0xFF66FF, 0x66FFFF, 0xFFFFFF};
+
+static lv_color_t palette_color(uint8_t idx) {
+  if (idx < 16)
+    return lv_color_hex(base_palette[idx]);
+  if (idx < 232) {
+    // 6x6x6 colour cube
+    static const uint8_t steps[6] = {0, 95, 135, 175, 215, 255};
+    idx -= 16;
+    return lv_color_make(steps[idx / 36], steps[(idx / 6) % 6], steps[idx % 6]);
+  }
+  uint8_t g = 8 + (idx - 232) * 10; // Greyscale ramp
+  return lv_color_make(g, g, g);
+}
+
+lv_obj_t *TerminalView::create(lv_obj_t *parent, TerminalGrid *grid,
+                               const lv_font_t *font) {
+  _grid = grid;
+  _font = font;
+  _fg = lv_color_hex(0xFFDD00);
+  _bg = lv_color_hex(0x000000);
+
+#if TERM_GLYPH_ATLAS
+  _cell_w = _atlas.cell_w();
+  _cell_h = _atlas.cell_h();
+#else
+  _cell_w = lv_font_get_glyph_width(font, '0', 0);
+  _cell_h = lv_font_get_line_height(font);
+#endif
+  if (_cell_w <= 0)
+    _cell_w = 7;
+  if (_cell_h <= 0)
+    _cell_h = 14;
+
+  _obj = lv_obj_create(parent);
+  lv_obj_remove_style_all(_obj);
+  lv_obj_set_size(_obj, LV_PCT(100), LV_PCT(100));
+  lv_obj_clear_flag(_obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_add_event_cb(_obj, draw_cb, LV_EVENT_DRAW_MAIN, this);
+  return _obj;
+}
+
+void TerminalView::set_theme(lv_color_t fg, lv_color_t bg) {
+  _fg = fg;
+  _bg = bg;
+  if (_obj)
+    lv_obj_invalidate(_obj);
+}
+
+void TerminalView::fit(uint16_t &cols, uint16_t &rows) {
+  if (!_obj)
+    return;
+  lv_obj_update_layout(_obj);
+  int32_t w = lv_obj_get_content_width(_obj);
+  int32_t h = lv_obj_get_content_height(_obj);
+  cols = w / _cell_w > 0 ? w / _cell_w : 1;
+  rows = h / _cell_h > 0 ? h / _cell_h : 1;
+}
+
+void TerminalView::invalidate_row(uint16_t r) {
+  lv_area_t coords;
+  lv_obj_get_content_coords(_obj, &coords);
+  lv_area_t a;
+  a.x1 = coords.x1;
+  a.x2 = coords.x2;
+  a.y1 = coords.y1 + r * _cell_h;
+  a.y2 = a.y1 + _cell_h - 1;
+  lv_obj_invalidate_area(_obj, &a);
+}
+
+void TerminalView::attach(TerminalGrid *grid, Scrollback *sb) {
+  _grid = grid;
+  _scrollback = sb;
+  _offset = 0;
+  _seen_total = sb ? sb->total() : 0;
+  _drawn_cursor_row = grid->cursor_row();
+  _drawn_cursor_col = grid->cursor_col();
+  grid->clear_dirty(); // Covered by the full repaint
+  if (_obj)
+    lv_obj_invalidate(_obj);
+}
+
+void TerminalView::scroll_by(int lines) {
+  if (!_scrollback || !_obj || _grid->in_alt_screen())
+    return;
+  int64_t off = (int64_t)_offset + lines;
+  if (off < 0)
+    off = 0;
+  if (off > _scrollback->count())
+    off = _scrollback->count();
+  if ((uint32_t)off == _offset)
+    return;
+  _offset = off;
+  lv_obj_invalidate(_obj); // One window repaint, history is not re-laid out
+}
+
+void TerminalView::scroll_to_bottom() {
+  if (_offset == 0)
+    return;
+  _offset = 0;
+  if (_obj)
+    lv_obj_invalidate(_obj);
+}
+
+void TerminalView::scroll_to_line(uint32_t id) {
+  if (!_scrollback)
+    return;
+  uint32_t oldest = _scrollback->total() - _scrollback->count();
+  if (id < oldest || id >= _scrollback->total())
+    return;
+  // Visible row r shows history index count - offset + r
+  int64_t want =
+      (int64_t)_scrollback->count() - (id - oldest) + _grid->rows() / 2;
+  scroll_by((int)(want - (int64_t)_offset));
+}
+
+void TerminalView::set_highlight(const char *query, uint16_t qlen,
+                                 uint32_t current_id) {
+  _hl_query = query;
+  _hl_len = qlen;
+  _hl_current = current_id;
+  if (_obj)
+    lv_obj_invalidate(_obj);
+}
+
+const TermCell *TerminalView::visible_row(int32_t r, uint16_t *len,
+                                          uint32_t *id) const {
+  *id = UINT32_MAX;
+  int32_t v = r - (int32_t)_offset; // Negative = history line
+  if (v >= 0) {
+    *len = _grid->cols();
+    return _grid->row(v);
+  }
+  int32_t h = (int32_t)_scrollback->count() + v;
+  if (h < 0) {
+    *len = 0;
+    return nullptr;
+  }
+  *id = _scrollback->total() - _scrollback->count() + h;
+  return _scrollback->line(h, len);
+}
+
+void TerminalView::sync() {
+  if (!_obj || !_grid)
+    return;
+
+  if (_offset > 0) {
+    // Keep the window on the same history lines as new ones are pushed
+    uint32_t pushed = _scrollback->total() - _seen_total;
+    _seen_total = _scrollback->total();
+    if (pushed) {
+      _offset += pushed;
+      if (_offset > _scrollback->count())
+        _offset = _scrollback->count();
+    }
+    if (_grid->any_dirty() && _offset < _grid->rows())
+      lv_obj_invalidate(_obj); // Live rows are partly on screen
+    _grid->clear_dirty();
+    return;
+  }
+  if (_scrollback)
+    _seen_total = _scrollback->total();
+
+  if (_grid->cursor_row() != _drawn_cursor_row ||
+      _grid->cursor_col() != _drawn_cursor_col) {
+    _grid->mark_dirty(_drawn_cursor_row);
+    _grid->mark_dirty(_grid->cursor_row());
+  }
+
+  if (!_grid->any_dirty())
+    return;
+
+  for (uint16_t r = 0; r < _grid->rows(); r++) {
+    if (_grid->is_dirty(r))
+      invalidate_row(r);
+  }
+  _grid->clear_dirty();
+  _drawn_cursor_row = _grid->cursor_row();
+  _drawn_cursor_col = _grid->cursor_col();
+}
+
+void TerminalView::draw_cb(lv_event_t *e) {
+  TerminalView *view = (TerminalView *)lv_event_get_user_data(e);
+  if (view)
+    view->draw(lv_event_get_layer(e));
+}
+
+void TerminalView::cell_colors(const TermCell &cell, bool cursor, uint8_t hl,
+                               lv_color_t *fg, lv_color_t *bg,
+                               bool *has_bg) const {
+  bool inverse = cell.flags & TERM_ATTR_INVERSE;
+  *has_bg = !(cell.flags & TERM_ATTR_DEFAULT_BG);
+  uint8_t fg_idx = cell.fg;
+  if ((cell.flags & TERM_ATTR_BOLD) && fg_idx < 8)
+    fg_idx += 8; // Bold brightens the base colours
+  *fg = (cell.flags & TERM_ATTR_DEFAULT_FG) ? _fg : palette_color(fg_idx);
+  *bg = *has_bg ? palette_color(cell.bg) : _bg;
+
+  if (inverse != cursor) {
+    lv_color_t t = *fg;
+    *fg = *bg;
+    *bg = t;
+    *has_bg = true;
+  }
+  if (hl) {
+    *fg = lv_color_hex(0x000000);
+    *bg = hl == 2 ? lv_color_hex(0xFF6600) : lv_color_hex(0x887700);
+    *has_bg = true;
+  }
+}
+
+void TerminalView::draw_glyph(lv_layer_t *layer, const TermCell &cell,
+                              lv_color_t fg, int32_t x, int32_t y) {
+  lv_draw_label_dsc_t glyph_dsc;
+  lv_draw_label_dsc_init(&glyph_dsc);
+  glyph_dsc.font = _font;
+  glyph_dsc.color = fg;
+  glyph_dsc.opa =
+      (cell.flags & TERM_ATTR_DIM) ? LV_OPA_60 : (lv_opa_t)LV_OPA_COVER;
+  // Centre the font's line in the cell, which may be shorter
+  lv_point_t pt = {x, y - (lv_font_get_line_height(_font) - _cell_h) / 2};
+  lv_draw_character(layer, &glyph_dsc, &pt, cell.glyph);
+}
+
+void TerminalView::draw_row(lv_layer_t *layer, int32_t r, int32_t x0,
+                            int32_t y, const TermCell *line, uint16_t len,
+                            const uint8_t *hl) {
+  lv_draw_rect_dsc_t bg_dsc;
+  lv_draw_rect_dsc_init(&bg_dsc);
+  bg_dsc.radius = 0;
+  bg_dsc.bg_opa = LV_OPA_COVER;
+
+  for (uint16_t c = 0; c < len; c++) {
+    const TermCell &cell = line[c];
+    bool cursor = _offset == 0 && _grid->cursor_visible() &&
+                  r == _grid->cursor_row() && c == _grid->cursor_col();
+    lv_color_t fg, bg;
+    bool has_bg;
+    cell_colors(cell, cursor, hl ? hl[c] : 0, &fg, &bg, &has_bg);
+
+    int32_t x = x0 + c * _cell_w;
+    if (has_bg) {
+      lv_area_t a = {x, y, x + _cell_w - 1, y + _cell_h - 1};
+      bg_dsc.bg_color = bg;
+      lv_draw_rect(layer, &bg_dsc, &a);
+    }
+
+    if (cell.flags & TERM_ATTR_UNDERLINE) {
+      lv_area_t u = {x, y + _cell_h - 2, x + _cell_w - 1, y + _cell_h - 2};
+      bg_dsc.bg_color = fg;
+      lv_draw_rect(layer, &bg_dsc, &u);
+    }
+
+    if (cell.glyph == ' ' || (cell.flags & TERM_ATTR_HIDDEN))
+      continue;
+    draw_glyph(layer, cell, fg, x, y);
+  }
+}
+
+#if TERM_GLYPH_ATLAS
+TerminalView::~TerminalView() { heap_caps_free(_strip); }
+
+bool TerminalView::reserve_strip(uint16_t rows) {
+  uint16_t cols = _grid->cols();
+  if (_strip && rows <= _strip_rows && cols == _strip_cols)
+    return true;
+  // Old descriptors may be in LVGL's image cache with the old geometry
+  for (uint16_t i = 0; i < _strip_rows; i++)
+    lv_image_cache_drop(&_strip_img[i]);
+  heap_caps_free(_strip);
+  _strip_rows = 0;
+
+  size_t bytes = (size_t)rows * cols * _cell_w * _cell_h * sizeof(uint16_t);
+  _strip = (uint16_t *)heap_caps_malloc(bytes,
+                                        MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!_strip)
+    _strip = (uint16_t *)heap_caps_malloc(bytes, MALLOC_CAP_8BIT);
+  if (!_strip)
+    return false;
+  _strip_rows = rows;
+  _strip_cols = cols;
+
+  uint32_t w = (uint32_t)cols * _cell_w;
+  for (uint16_t i = 0; i < rows; i++) {
+    lv_image_dsc_t &img = _strip_img[i];
+    memset(&img, 0, sizeof(img));
+    img.header.magic = LV_IMAGE_HEADER_MAGIC;
+    img.header.cf = LV_COLOR_FORMAT_RGB565;
+    img.header.w = w;
+    img.header.h = _cell_h;
+    img.header.stride = w * sizeof(uint16_t);
+    img.data_size = img.header.stride * _cell_h;
+    img.data = (const uint8_t *)(_strip + (size_t)i * w * _cell_h);
+  }
+  return true;
+}
+
+void TerminalView::blit_row(lv_layer_t *layer, int32_t r, int32_t x0,
+                            int32_t y, const TermCell *line, uint16_t len,
+                            const uint8_t *hl, uint16_t slot) {
+  uint16_t cols = _strip_cols;
+  uint32_t stride = (uint32_t)cols * _cell_w; // Pixels
+  uint16_t *px = (uint16_t *)_strip_img[slot].data;
+  uint16_t theme_bg = lv_color_to_u16(_bg);
+  uint16_t fallback[TERM_MAX_COLS]; // Cells the atlas has no glyph for
+  uint16_t nfallback = 0;
+
+  for (uint16_t c = 0; c < cols; c++) {
+    uint16_t *cell_px = px + c * _cell_w;
+    const TermCell *cell = c < len ? &line[c] : nullptr;
+    bool cursor = _offset == 0 && _grid->cursor_visible() &&
+                  r == _grid->cursor_row() && c == _grid->cursor_col();
+    lv_color_t fg = _fg, bg = _bg;
+    bool has_bg = false; // Past the end of a history line
+    if (cell)
+      cell_colors(*cell, cursor, hl ? hl[c] : 0, &fg, &bg, &has_bg);
+    uint16_t bg16 = has_bg ? lv_color_to_u16(bg) : theme_bg;
+
+    bool blank = !cell || cell->glyph == ' ' ||
+                 (cell->flags & TERM_ATTR_HIDDEN);
+    const uint16_t *tile = nullptr;
+    if (!blank) {
+      if (cell->flags & TERM_ATTR_DIM)
+        fg = lv_color_mix(fg, bg, LV_OPA_60);
+      tile = _atlas.tile(_atlas.index(cell->glyph), lv_color_to_u16(fg),
+                         bg16);
+      if (!tile)
+        fallback[nfallback++] = c;
+    }
+
+    if (tile) {
+      for (int32_t ty = 0; ty < _cell_h; ty++)
+        memcpy(cell_px + ty * stride, tile + ty * _cell_w,
+               _cell_w * sizeof(uint16_t));
+    } else {
+      for (int32_t ty = 0; ty < _cell_h; ty++)
+        for (int32_t tx = 0; tx < _cell_w; tx++)
+          cell_px[ty * stride + tx] = bg16;
+    }
+
+    if (cell && (cell->flags & TERM_ATTR_UNDERLINE)) {
+      uint16_t fg16 = lv_color_to_u16(fg);
+      uint16_t *u = cell_px + (_cell_h - 2) * stride;
+      for (int32_t tx = 0; tx < _cell_w; tx++)
+        u[tx] = fg16;
+    }
+  }
+
+  lv_draw_image_dsc_t img_dsc;
+  lv_draw_image_dsc_init(&img_dsc);
+  img_dsc.src = &_strip_img[slot];
+  lv_area_t a = {x0, y, x0 + (int32_t)stride - 1, y + _cell_h - 1};
+  lv_draw_image(layer, &img_dsc, &a);
+
+  // Drawn after the image, so over the cell backgrounds it set
+  for (uint16_t i = 0; i < nfallback; i++) {
+    uint16_t c = fallback[i];
+    bool cursor = _offset == 0 && _grid->cursor_visible() &&
+                  r == _grid->cursor_row() && c == _grid->cursor_col();
+    lv_color_t fg, bg;
+    bool has_bg;
+    cell_colors(line[c], cursor, hl ? hl[c] : 0, &fg, &bg, &has_bg);
+    draw_glyph(layer, line[c], fg, x0 + c * _cell_w, y);
+  }
+}
+#else
+TerminalView::~TerminalView() {}
+#endif
+
+void TerminalView::draw(lv_layer_t *layer) {
+  if (!_grid || !_grid->rows())
+    return;
+
+  lv_area_t coords;
+  lv_obj_get_content_coords(_obj, &coords);
+
+  // Only walk rows that intersect the area LVGL is currently redrawing
+  const lv_area_t &clip = layer->_clip_area;
+  int32_t first = (clip.y1 - coords.y1) / _cell_h;
+  int32_t last = (clip.y2 - coords.y1) / _cell_h;
+  if (first < 0)
+    first = 0;
+  if (last >= _grid->rows())
+    last = _grid->rows() - 1;
+  if (last < first)
+    return;
+
+#if TERM_GLYPH_ATLAS
+  bool blit = reserve_strip(last - first + 1);
+#endif
+
+  for (int32_t r = first; r <= last; r++) {
+    uint16_t len = _grid->cols();
+    uint32_t id = UINT32_MAX;
+    const TermCell *line =
+        _offset ? visible_row(r, &len, &id) : _grid->row(r);
+    if (!line)
+      len = 0;
+    int32_t y = coords.y1 + r * _cell_h;
+
+    // Search matches on this row, as [start, end) cell ranges
+    uint8_t hl[TERM_MAX_COLS];
+    if (_hl_len && len) {
+      uint8_t mark = id != UINT32_MAX && id == _hl_current ? 2 : 1;
+      memset(hl, 0, len);
+      int at = 0;
+      while ((at = ScrollbackSearch::find(line, len, _hl_query, _hl_len,
+                                          at)) >= 0) {
+        memset(hl + at, mark, _hl_len);
+        at += _hl_len;
+      }
+    }
+
+#if TERM_GLYPH_ATLAS
+    if (blit) {
+      blit_row(layer, r, coords.x1, y, line, len, _hl_len ? hl : nullptr,
+               r - first);
+      continue;
+    }
+#endif
+    if (line)
+      draw_row(layer, r, coords.x1, y, line, len, _hl_len ? hl : nullptr);
+  }
+}
@@ -0,0 +1,111 @@
+#ifndef TERMINAL_VIEW_H
+#define TERMINAL_VIEW_H
+
+#include "GlyphAtlas.h"
+#include "Scrollback.h"
+#include "TerminalGrid.h"
+#include <lvgl.h>
+
+/**
+ * TerminalView
+ * Custom LVGL object that paints a TerminalGrid cell by cell. sync() turns
+ * the grid's dirty-row bitmap into per-row invalidations, so LVGL only
+ * re-renders the bands that changed instead of re-laying out a label.
+ *
+ * With a Scrollback attached the view can be moved back through history:
+ * visible rows are then taken from the history ring and the top of the
+ * grid, and only that window is drawn.
+ *
+ * With TERM_GLYPH_ATLAS each row is composed from GlyphAtlas tiles into a
+ * strip and handed to LVGL as one RGB565 image, which the software
+ * renderer copies line by line into the draw buffer. The font passed to
+ * create() then only draws code points the atlas lacks.
+ */
+
+#ifndef TERM_GLYPH_ATLAS
+#define TERM_GLYPH_ATLAS 1
+#endif
+
+class TerminalView {
+public:
+  ~TerminalView();
+
+  lv_obj_t *create(lv_obj_t *parent, TerminalGrid *grid,
+                   const lv_font_t *font);
+  void set_theme(lv_color_t fg, lv_color_t bg);
+
+  // How many cells fit in the object's content area
+  void fit(uint16_t &cols, uint16_t &rows);
+
+  // Invalidate dirty rows (and cursor movement). Call with LVGL locked.
+  void sync();
+
+  // Show another grid and history (session switch): back to live output,
+  // whole view repainted
+  void attach(TerminalGrid *grid, Scrollback *sb);
+
+  // History view. offset = lines above the live screen, 0 = live.
+  // While scrolled back the window stays on the same lines as output
+  // arrives.
+  void set_scrollback(Scrollback *sb) { _scrollback = sb; }
+  void scroll_by(int lines); // Positive = back into history
+  void scroll_to_bottom();
+  uint32_t scroll_offset() const { return _offset; }
+  // Bring history line id (Scrollback::total() numbering) to mid-screen
+  void scroll_to_line(uint32_t id);
+
+  // Highlight occurrences of a folded query (ScrollbackSearch::query());
+  // the line with current_id gets the strong highlight. qlen 0 = off.
+  void set_highlight(const char *query, uint16_t qlen, uint32_t current_id);
+
+  lv_obj_t *obj() const { return _obj; }
+
+private:
+  lv_obj_t *_obj = nullptr;
+  TerminalGrid *_grid = nullptr;
+  const lv_font_t *_font = nullptr;
+  int32_t _cell_w = 7;
+  int32_t _cell_h = 14;
+  lv_color_t _fg;
+  lv_color_t _bg;
+  uint16_t _drawn_cursor_row = 0;
+  uint16_t _drawn_cursor_col = 0;
+  Scrollback *_scrollback = nullptr;
+  uint32_t _offset = 0;
+  uint32_t _seen_total = 0; // Scrollback::total() at the last sync
+  const char *_hl_query = nullptr;
+  uint16_t _hl_len = 0;
+  uint32_t _hl_current = 0;
+#if TERM_GLYPH_ATLAS
+  GlyphAtlas _atlas;
+  // Rows composed for the band being drawn; LVGL copies them out before
+  // the next band's draw callback runs
+  uint16_t *_strip = nullptr;
+  uint16_t _strip_rows = 0;
+  uint16_t _strip_cols = 0;
+  lv_image_dsc_t _strip_img[TERM_MAX_ROWS];
+
+  bool reserve_strip(uint16_t rows);
+  void blit_row(lv_layer_t *layer, int32_t r, int32_t x, int32_t y,
+                const TermCell *line, uint16_t len, const uint8_t *hl,
+                uint16_t slot);
+#endif
+
+  // Cells for visible row r given the scroll offset; len = cells stored,
+  // id = history line id or UINT32_MAX for a live row
+  const TermCell *visible_row(int32_t r, uint16_t *len, uint32_t *id) const;
+
+  static void draw_cb(lv_event_t *e);
+  void draw(lv_layer_t *layer);
+  void draw_row(lv_layer_t *layer, int32_t r, int32_t x, int32_t y,
+                const TermCell *line, uint16_t len, const uint8_t *hl);
+  void draw_glyph(lv_layer_t *layer, const TermCell &cell, lv_color_t fg,
+                  int32_t x, int32_t y);
+  // Colours of one cell after bold, inverse, cursor and search highlight;
+  // has_bg is false when the cell shows the theme background
+  void cell_colors(const TermCell &cell, bool cursor, uint8_t hl,
+                   lv_color_t *fg, lv_color_t *bg, bool *has_bg) const;
+  void invalidate_row(uint16_t r);
+};
+
+#endif // TERMINAL_VIEW_H
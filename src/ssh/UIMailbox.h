@@ -0,0 +1,179 @@
+#ifndef UI_MAILBOX_H
+#define UI_MAILBOX_H
+
+#include "UIMessageQueue.h"
+#include <Arduino.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+/**
+ * UIMailbox
+ * Single coalescing channel from background tasks to the LVGL task,
+ * drained once per lv_timer_handler pass instead of one lv_async_call (and
+ * one LVGL timer allocation) per update.
+ *
+ * - Text appends are merged into the newest pooled UIMessage until it is
+ *   full, so a burst of small appends becomes one grid write.
+ * - Status, input line and screen requests are latest-wins: only the most
+ *   recent value survives to the next frame.
+ * - Pending work is a dirty bitmask; nothing is allocated per update.
+ * - Marking work notifies the consumer task, so it can block between
+ *   frames instead of polling.
+ */
+
+#define UI_DIRTY_TEXT 0x01    // Local text queued
+#define UI_DIRTY_RX 0x02      // PTY bytes waiting in a receive ring
+#define UI_DIRTY_STATUS 0x04  // Status bar text changed
+#define UI_DIRTY_INPUT 0x08   // Input line changed
+#define UI_DIRTY_SCREEN 0x10  // Screen switch requested
+#define UI_DIRTY_LIVE 0x20    // Leave scrollback view, back to live output
+#define UI_DIRTY_SEARCH 0x40  // Scrollback search query edited
+#define UI_DIRTY_SESSION 0x80 // Shell ended on the remote side
+#define UI_DIRTY_SWITCH 0x100 // Show another session
+
+#define UI_STATUS_LEN 96
+#define UI_INPUT_LEN 256
+
+enum UIScreen : uint8_t { UI_SCREEN_LAUNCHER = 0, UI_SCREEN_TERMINAL };
+
+class UIMailbox {
+public:
+  typedef void (*TextSink)(const char *text, size_t len, void *ctx);
+
+  UIMailbox() {}
+
+  // ---- Producers (any task) ----
+
+  // Append text, merging into the queued tail message where possible.
+  // Returns false if text had to be dropped (pool exhausted after wait_ms).
+  bool post_text(const char *text, uint32_t wait_ms) {
+    size_t len = strlen(text);
+    bool ok = true;
+    while (len > 0) {
+      portENTER_CRITICAL(&_mux);
+      if (_count) {
+        UIMessage *tail = _fifo[(_head + _count - 1) % UI_POOL_SIZE];
+        size_t room = MAX_ASYNC_TEXT - 1 - tail->len;
+        size_t n = len < room ? len : room;
+        memcpy(tail->text + tail->len, text, n);
+        tail->len += n;
+        tail->text[tail->len] = '\0';
+        text += n;
+        len -= n;
+      }
+      portEXIT_CRITICAL(&_mux);
+      if (len == 0)
+        break;
+
+      UIMessage *msg = _pool.checkout(wait_ms);
+      if (!msg) {
+        ok = false;
+        break;
+      }
+      size_t n = len < MAX_ASYNC_TEXT - 1 ? len : MAX_ASYNC_TEXT - 1;
+      memcpy(msg->text, text, n);
+      msg->text[n] = '\0';
+      msg->len = n;
+      text += n;
+      len -= n;
+
+      portENTER_CRITICAL(&_mux);
+      _fifo[(_head + _count) % UI_POOL_SIZE] = msg;
+      _count++;
+      portEXIT_CRITICAL(&_mux);
+    }
+    mark(UI_DIRTY_TEXT);
+    return ok;
+  }
+
+  void set_status(const char *text) {
+    set_string(_status, text, UI_DIRTY_STATUS);
+  }
+  void set_input(const char *text) {
+    set_string(_input, text, UI_DIRTY_INPUT);
+  }
+
+  void request_screen(UIScreen screen) {
+    _screen = screen;
+    mark(UI_DIRTY_SCREEN);
+  }
+
+  void request_session(uint8_t slot) {
+    _session = slot;
+    mark(UI_DIRTY_SWITCH);
+  }
+
+  void mark(uint32_t bits) {
+    _dirty.fetch_or(bits, std::memory_order_release);
+    if (_consumer)
+      xTaskNotifyGive(_consumer);
+  }
+
+  // ---- Consumer (LVGL task) ----
+
+  // Task woken by mark(); it waits with ulTaskNotifyTake
+  void set_consumer(TaskHandle_t task) { _consumer = task; }
+
+  // Fetch and clear the pending-work mask
+  uint32_t take() { return _dirty.exchange(0, std::memory_order_acquire); }
+  bool pending() const { return _dirty.load(std::memory_order_relaxed) != 0; }
+
+  // Hand every queued text message to sink in order, then recycle it
+  void drain_text(TextSink sink, void *ctx) {
+    UIMessage *batch[UI_POOL_SIZE];
+    uint8_t n = 0;
+    portENTER_CRITICAL(&_mux);
+    while (_count) {
+      batch[n++] = _fifo[_head];
+      _head = (_head + 1) % UI_POOL_SIZE;
+      _count--;
+    }
+    portEXIT_CRITICAL(&_mux);
+
+    for (uint8_t i = 0; i < n; i++) {
+      sink(batch[i]->text, batch[i]->len, ctx);
+      _pool.release(batch[i]);
+    }
+  }
+
+  void copy_status(char *out, size_t max) { copy_string(_status, out, max); }
+  void copy_input(char *out, size_t max) { copy_string(_input, out, max); }
+  UIScreen requested_screen() const { return _screen; }
+  uint8_t requested_session() const { return _session; }
+
+  UIMessageQueue::Stats pool_stats() const { return _pool.stats(); }
+
+private:
+  portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+  UIMessageQueue _pool;
+  UIMessage *_fifo[UI_POOL_SIZE];
+  uint8_t _head = 0;
+  uint8_t _count = 0;
+
+  char _status[UI_STATUS_LEN] = {0};
+  char _input[UI_INPUT_LEN] = {0};
+  volatile UIScreen _screen = UI_SCREEN_LAUNCHER;
+  volatile uint8_t _session = 0;
+  std::atomic<uint32_t> _dirty = {0};
+  TaskHandle_t _consumer = nullptr;
+
+  template <size_t N> void set_string(char (&dst)[N], const char *src,
+                                      uint32_t bit) {
+    portENTER_CRITICAL(&_mux);
+    strncpy(dst, src, N - 1);
+    dst[N - 1] = '\0';
+    portEXIT_CRITICAL(&_mux);
+    mark(bit);
+  }
+
+  template <size_t N> void copy_string(const char (&src)[N], char *out,
+                                       size_t max) {
+    portENTER_CRITICAL(&_mux);
+    strncpy(out, src, max - 1);
+    out[max - 1] = '\0';
+    portEXIT_CRITICAL(&_mux);
+  }
+};
+
+#endif // UI_MAILBOX_H
@@ -2,57 +2,127 @@
 #define UI_MESSAGE_QUEUE_H
 
 #include <Arduino.h>
-#include <mutex>
-#include <string>
-#include <vector>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 
 /**
  * UIMessageQueue
  * A thread-safe, pre-allocated pool of messages to avoid heap fragmentation
  * during high-speed terminal data reception.
+ *
+ * Free slots are tracked in an atomic 32-bit bitmap: checkout() claims the
+ * lowest set bit with __builtin_ctz and a CAS, release() sets it again, so
+ * both are O(1) and lock-free. When the pool is exhausted a caller may wait
+ * a bounded time for a slot; exhaustion and drops are counted either way.
  */
 
+#ifndef UI_POOL_SIZE
 #define UI_POOL_SIZE 16
+#endif
+#ifndef MAX_ASYNC_TEXT
 #define MAX_ASYNC_TEXT 1024
+#endif
+
+#if UI_POOL_SIZE < 1 || UI_POOL_SIZE > 32
+#error "UI_POOL_SIZE must be between 1 and 32 (one bit per slot)"
+#endif
 
 struct UIMessage {
   char text[MAX_ASYNC_TEXT];
+  uint16_t len;
   bool clear;
-  bool in_use;
   uint32_t id;
 };
 
 class UIMessageQueue {
 public:
+  struct Stats {
+    uint32_t in_use;      // Slots currently checked out
+    uint32_t high_water;  // Peak slots checked out at once
+    uint32_t exhaustions; // checkout() calls that found the pool empty
+    uint32_t drops;       // checkout() calls that returned nullptr
+  };
+
   UIMessageQueue() {
     for (int i = 0; i < UI_POOL_SIZE; i++) {
-      pool[i].in_use = false;
       pool[i].id = i;
     }
+    _free = UI_POOL_SIZE == 32 ? 0xFFFFFFFFu : (1u << UI_POOL_SIZE) - 1;
+    _released = xSemaphoreCreateBinary();
   }
 
-  UIMessage *checkout() {
-    // Simple linear search for an available message
-    // In a real high-perf system we'd use a bitmask or semaphore
-    for (int i = 0; i < UI_POOL_SIZE; i++) {
-      if (!pool[i].in_use) {
-        pool[i].in_use = true;
-        pool[i].text[0] = '\0';
-        pool[i].clear = false;
-        return &pool[i];
+  // Claim a free slot, waiting up to wait_ms for one if the pool is empty
+  UIMessage *checkout(uint32_t wait_ms = 0) {
+    UIMessage *msg = try_checkout();
+    if (msg)
+      return msg;
+
+    _exhaustions++;
+    if (wait_ms && _released) {
+      TickType_t start = xTaskGetTickCount();
+      TickType_t limit = pdMS_TO_TICKS(wait_ms);
+      TickType_t elapsed;
+      while ((elapsed = xTaskGetTickCount() - start) < limit) {
+        xSemaphoreTake(_released, limit - elapsed);
+        msg = try_checkout();
+        if (msg)
+          return msg;
       }
     }
+
+    _drops++;
     return nullptr; // Pool exhausted
   }
 
   void release(UIMessage *msg) {
-    if (msg) {
-      msg->in_use = false;
-    }
+    if (!msg || msg->id >= UI_POOL_SIZE)
+      return;
+    uint32_t bit = 1u << msg->id;
+    uint32_t prev = _free.fetch_or(bit, std::memory_order_release);
+    if (prev & bit)
+      return; // Double release, slot was already free
+    _in_use--;
+    if (_released)
+      xSemaphoreGive(_released);
+  }
+
+  Stats stats() const {
+    Stats s;
+    s.in_use = _in_use;
+    s.high_water = _high_water;
+    s.exhaustions = _exhaustions;
+    s.drops = _drops;
+    return s;
   }
 
 private:
   UIMessage pool[UI_POOL_SIZE];
+  std::atomic<uint32_t> _free;
+  std::atomic<uint32_t> _in_use = {0};
+  std::atomic<uint32_t> _high_water = {0};
+  std::atomic<uint32_t> _exhaustions = {0};
+  std::atomic<uint32_t> _drops = {0};
+  SemaphoreHandle_t _released = nullptr;
+
+  UIMessage *try_checkout() {
+    uint32_t cur = _free.load(std::memory_order_acquire);
+    while (cur) {
+      int slot = __builtin_ctz(cur);
+      uint32_t next = cur & ~(1u << slot);
+      if (_free.compare_exchange_weak(cur, next, std::memory_order_acquire)) {
+        uint32_t used = ++_in_use;
+        uint32_t hw = _high_water.load(std::memory_order_relaxed);
+        while (used > hw && !_high_water.compare_exchange_weak(hw, used)) {
+        }
+        pool[slot].text[0] = '\0';
+        pool[slot].len = 0;
+        pool[slot].clear = false;
+        return &pool[slot];
+      }
+    }
+    return nullptr;
+  }
 };
 
 #endif // UI_MESSAGE_QUEUE_H
@@ -0,0 +1,677 @@
+/**
+ * VTParser - table-driven DEC/xterm escape-sequence parser
+ */
+
+#include "VTParser.h"
+#include <stdio.h>
+#include <string.h>
+
+// Transition table entries pack (action << 4) | next_state
+enum Action : uint8_t {
+  A_IGNORE = 0,
+  A_PRINT,
+  A_EXECUTE,
+  A_COLLECT,
+  A_PARAM,
+  A_ESC_DISPATCH,
+  A_CSI_DISPATCH,
+};
+
+#define NO_TRANSITION 0x0F
+
+// Only 7-bit input is table-driven; bytes >= 0x80 are UTF-8 in GROUND and
+// ignored elsewhere (8-bit C1 controls are not recognised, as in xterm's
+// UTF-8 mode).
+static uint8_t s_table[VTParser::STATE_COUNT][128];
+static bool s_table_ready = false;
+
+static void table_set(uint8_t state, uint8_t lo, uint8_t hi, uint8_t action,
+                      uint8_t next = NO_TRANSITION) {
+  for (int c = lo; c <= hi; c++)
+    s_table[state][c] = (uint8_t)((action << 4) | next);
+}
+
+// C0 controls except CAN, SUB and ESC, which are handled "anywhere"
+static void table_set_c0(uint8_t state, uint8_t action) {
+  table_set(state, 0x00, 0x17, action);
+  table_set(state, 0x19, 0x19, action);
+  table_set(state, 0x1C, 0x1F, action);
+}
+
+static void build_table() {
+  for (int s = 0; s < VTParser::STATE_COUNT; s++) {
+    table_set(s, 0x00, 0x7F, A_IGNORE);
+    // Anywhere transitions
+    table_set(s, 0x18, 0x18, A_EXECUTE, VTParser::GROUND);
+    table_set(s, 0x1A, 0x1A, A_EXECUTE, VTParser::GROUND);
+    table_set(s, 0x1B, 0x1B, A_IGNORE, VTParser::ESCAPE);
+  }
+
+  // GROUND
+  table_set_c0(VTParser::GROUND, A_EXECUTE);
+  table_set(VTParser::GROUND, 0x20, 0x7E, A_PRINT);
+
+  // ESCAPE
+  table_set_c0(VTParser::ESCAPE, A_EXECUTE);
+  table_set(VTParser::ESCAPE, 0x20, 0x2F, A_COLLECT,
+            VTParser::ESCAPE_INTERMEDIATE);
+  table_set(VTParser::ESCAPE, 0x30, 0x7E, A_ESC_DISPATCH, VTParser::GROUND);
+  table_set(VTParser::ESCAPE, 0x50, 0x50, A_IGNORE, VTParser::DCS_ENTRY);
+  table_set(VTParser::ESCAPE, 0x58, 0x58, A_IGNORE,
+            VTParser::SOS_PM_APC_STRING);
+  table_set(VTParser::ESCAPE, 0x5B, 0x5B, A_IGNORE, VTParser::CSI_ENTRY);
+  table_set(VTParser::ESCAPE, 0x5D, 0x5D, A_IGNORE, VTParser::OSC_STRING);
+  table_set(VTParser::ESCAPE, 0x5E, 0x5F, A_IGNORE,
+            VTParser::SOS_PM_APC_STRING);
+
+  // ESCAPE_INTERMEDIATE
+  table_set_c0(VTParser::ESCAPE_INTERMEDIATE, A_EXECUTE);
+  table_set(VTParser::ESCAPE_INTERMEDIATE, 0x20, 0x2F, A_COLLECT);
+  table_set(VTParser::ESCAPE_INTERMEDIATE, 0x30, 0x7E, A_ESC_DISPATCH,
+            VTParser::GROUND);
+
+  // CSI_ENTRY (':' is accepted as a sub-parameter separator, e.g. 38:5:n)
+  table_set_c0(VTParser::CSI_ENTRY, A_EXECUTE);
+  table_set(VTParser::CSI_ENTRY, 0x20, 0x2F, A_COLLECT,
+            VTParser::CSI_INTERMEDIATE);
+  table_set(VTParser::CSI_ENTRY, 0x30, 0x3B, A_PARAM, VTParser::CSI_PARAM);
+  table_set(VTParser::CSI_ENTRY, 0x3C, 0x3F, A_COLLECT, VTParser::CSI_PARAM);
+  table_set(VTParser::CSI_ENTRY, 0x40, 0x7E, A_CSI_DISPATCH,
+            VTParser::GROUND);
+
+  // CSI_PARAM
+  table_set_c0(VTParser::CSI_PARAM, A_EXECUTE);
+  table_set(VTParser::CSI_PARAM, 0x20, 0x2F, A_COLLECT,
+            VTParser::CSI_INTERMEDIATE);
+  table_set(VTParser::CSI_PARAM, 0x30, 0x3B, A_PARAM);
+  table_set(VTParser::CSI_PARAM, 0x3C, 0x3F, A_IGNORE, VTParser::CSI_IGNORE);
+  table_set(VTParser::CSI_PARAM, 0x40, 0x7E, A_CSI_DISPATCH,
+            VTParser::GROUND);
+
+  // CSI_INTERMEDIATE
+  table_set_c0(VTParser::CSI_INTERMEDIATE, A_EXECUTE);
+  table_set(VTParser::CSI_INTERMEDIATE, 0x20, 0x2F, A_COLLECT);
+  table_set(VTParser::CSI_INTERMEDIATE, 0x30, 0x3F, A_IGNORE,
+            VTParser::CSI_IGNORE);
+  table_set(VTParser::CSI_INTERMEDIATE, 0x40, 0x7E, A_CSI_DISPATCH,
+            VTParser::GROUND);
+
+  // CSI_IGNORE
+  table_set_c0(VTParser::CSI_IGNORE, A_EXECUTE);
+  table_set(VTParser::CSI_IGNORE, 0x40, 0x7E, A_IGNORE, VTParser::GROUND);
+
+  // DCS sequences are parsed for correct framing but their payload dropped
+  table_set(VTParser::DCS_ENTRY, 0x20, 0x2F, A_IGNORE,
+            VTParser::DCS_INTERMEDIATE);
+  table_set(VTParser::DCS_ENTRY, 0x30, 0x3F, A_IGNORE, VTParser::DCS_PARAM);
+  table_set(VTParser::DCS_ENTRY, 0x40, 0x7E, A_IGNORE,
+            VTParser::DCS_PASSTHROUGH);
+  table_set(VTParser::DCS_PARAM, 0x20, 0x2F, A_IGNORE,
+            VTParser::DCS_INTERMEDIATE);
+  table_set(VTParser::DCS_PARAM, 0x3A, 0x3A, A_IGNORE, VTParser::DCS_IGNORE);
+  table_set(VTParser::DCS_PARAM, 0x3C, 0x3F, A_IGNORE, VTParser::DCS_IGNORE);
+  table_set(VTParser::DCS_PARAM, 0x40, 0x7E, A_IGNORE,
+            VTParser::DCS_PASSTHROUGH);
+  table_set(VTParser::DCS_INTERMEDIATE, 0x30, 0x3F, A_IGNORE,
+            VTParser::DCS_IGNORE);
+  table_set(VTParser::DCS_INTERMEDIATE, 0x40, 0x7E, A_IGNORE,
+            VTParser::DCS_PASSTHROUGH);
+
+  // OSC: xterm also terminates on BEL
+  table_set(VTParser::OSC_STRING, 0x07, 0x07, A_IGNORE, VTParser::GROUND);
+}
+
+// DEC Special Graphics (ESC ( 0), 0x5F..0x7E
+static const uint16_t dec_graphics[32] = {
+    0x0020, 0x25C6, 0x2592, 0x2409, 0x240C, 0x240D, 0x240A, 0x00B0,
+    0x00B1, 0x2424, 0x240B, 0x2518, 0x2510, 0x250C, 0x2514, 0x253C,
+    0x23BA, 0x23BB, 0x2500, 0x23BC, 0x23BD, 0x251C, 0x2524, 0x2534,
+    0x252C, 0x2502, 0x2264, 0x2265, 0x03C0, 0x2260, 0x00A3, 0x00B7};
+
+VTParser::VTParser() {
+  if (!s_table_ready) {
+    build_table();
+    s_table_ready = true;
+  }
+  clear_sequence();
+}
+
+void VTParser::reset() {
+  _state = GROUND;
+  _utf8_left = 0;
+  _g_dec_graphics[0] = _g_dec_graphics[1] = false;
+  _gl = 0;
+  _app_cursor_keys = false;
+  _app_keypad = false;
+  _bracketed_paste = false;
+  clear_sequence();
+
+  _screen.use_alt_screen(false);
+  _screen.reset_pen();
+  _screen.reset_saved_cursor();
+  _screen.autowrap = true;
+  _screen.insert_mode = false;
+  _screen.origin_mode = false;
+  _screen.newline_mode = false;
+  _screen.set_cursor_visible(true);
+  _screen.clear();
+}
+
+void VTParser::feed(const char *data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    uint8_t c = (uint8_t)data[i];
+
+    if (c >= 0x80) {
+      if (_state != GROUND)
+        continue;
+      if ((c & 0xC0) == 0x80) {
+        if (_utf8_left) {
+          _utf8_cp = (_utf8_cp << 6) | (c & 0x3F);
+          if (--_utf8_left == 0)
+            print(_utf8_cp);
+        }
+      } else if ((c & 0xE0) == 0xC0) {
+        _utf8_cp = c & 0x1F;
+        _utf8_left = 1;
+      } else if ((c & 0xF0) == 0xE0) {
+        _utf8_cp = c & 0x0F;
+        _utf8_left = 2;
+      } else if ((c & 0xF8) == 0xF0) {
+        _utf8_cp = c & 0x07;
+        _utf8_left = 3;
+      }
+      continue;
+    }
+
+    // A 7-bit byte always terminates a partial UTF-8 sequence
+    _utf8_left = 0;
+
+    uint8_t entry = s_table[_state][c];
+    do_action(entry >> 4, c);
+    if ((entry & 0x0F) != NO_TRANSITION)
+      transition((State)(entry & 0x0F));
+  }
+
+  if (_held_len && at_ground()) {
+    put_local(_held, _held_len);
+    _held_len = 0;
+  }
+}
+
+void VTParser::write_local(const char *text, size_t len) {
+  if (at_ground() && !_held_len) {
+    put_local(text, len);
+    return;
+  }
+  // Completing the host's open sequence with it would corrupt both;
+  // beyond the hold buffer the text is dropped
+  size_t room = sizeof(_held) - _held_len;
+  if (len > room)
+    len = room;
+  memcpy(_held + _held_len, text, len);
+  _held_len += len;
+}
+
+void VTParser::put_local(const char *text, size_t len) {
+  _screen.begin_local();
+  for (size_t i = 0; i < len; i++) {
+    uint8_t c = (uint8_t)text[i];
+    if (c >= 0x80) {
+      if ((c & 0xC0) == 0x80) {
+        if (_local_left) {
+          _local_cp = (_local_cp << 6) | (c & 0x3F);
+          if (--_local_left == 0)
+            _screen.put(_local_cp);
+        }
+      } else if ((c & 0xE0) == 0xC0) {
+        _local_cp = c & 0x1F;
+        _local_left = 1;
+      } else if ((c & 0xF0) == 0xE0) {
+        _local_cp = c & 0x0F;
+        _local_left = 2;
+      } else if ((c & 0xF8) == 0xF0) {
+        _local_cp = c & 0x07;
+        _local_left = 3;
+      }
+      continue;
+    }
+    _local_left = 0;
+    if (c == '\n') {
+      _screen.carriage_return();
+      _screen.line_feed();
+    } else if (c == '\r') {
+      _screen.carriage_return();
+    } else if (c == '\t') {
+      _screen.tab();
+    } else if (c == 0x08) {
+      _screen.backspace();
+    } else if (c >= 0x20 && c < 0x7F) {
+      _screen.put(c);
+    }
+  }
+  _screen.end_local();
+}
+
+void VTParser::transition(State next) {
+  // Entry actions
+  if (next == ESCAPE || next == CSI_ENTRY || next == DCS_ENTRY)
+    clear_sequence();
+  _state = next;
+}
+
+void VTParser::do_action(uint8_t action, uint8_t c) {
+  switch (action) {
+  case A_PRINT:
+    print(c);
+    break;
+  case A_EXECUTE:
+    execute(c);
+    break;
+  case A_COLLECT:
+    collect(c);
+    break;
+  case A_PARAM:
+    param(c);
+    break;
+  case A_ESC_DISPATCH:
+    esc_dispatch(c);
+    break;
+  case A_CSI_DISPATCH:
+    csi_dispatch(c);
+    break;
+  default:
+    break;
+  }
+}
+
+void VTParser::clear_sequence() {
+  _nparams = 0;
+  _param_started = false;
+  _ninter = 0;
+  _private = 0;
+}
+
+void VTParser::print(uint32_t cp) {
+  if (_g_dec_graphics[_gl] && cp >= 0x5F && cp <= 0x7E)
+    cp = dec_graphics[cp - 0x5F];
+  _last_cp = cp;
+  _screen.put(cp);
+}
+
+void VTParser::execute(uint8_t c) {
+  switch (c) {
+  case 0x08:
+    _screen.backspace();
+    break;
+  case 0x09:
+    _screen.tab();
+    break;
+  case 0x0A:
+  case 0x0B:
+  case 0x0C:
+    if (_screen.newline_mode)
+      _screen.carriage_return();
+    _screen.line_feed();
+    break;
+  case 0x0D:
+    _screen.carriage_return();
+    break;
+  case 0x0E: // SO
+    _gl = 1;
+    break;
+  case 0x0F: // SI
+    _gl = 0;
+    break;
+  default: // BEL, NUL, CAN, SUB, ... are not rendered
+    break;
+  }
+}
+
+void VTParser::collect(uint8_t c) {
+  if (c >= 0x3C && c <= 0x3F && _nparams == 0 && _ninter == 0 && !_private) {
+    _private = (char)c;
+  } else if (_ninter < VT_MAX_INTERMEDIATES) {
+    _inter[_ninter++] = (char)c;
+  }
+}
+
+void VTParser::param(uint8_t c) {
+  if (!_param_started) {
+    _params[0] = 0;
+    _nparams = 1;
+    _param_started = true;
+  }
+  if (c == ';' || c == ':') {
+    if (_nparams < VT_MAX_PARAMS)
+      _params[_nparams++] = 0;
+    return;
+  }
+  uint16_t &p = _params[_nparams - 1];
+  uint32_t v = p * 10u + (c - '0');
+  p = v > 9999 ? 9999 : (uint16_t)v;
+}
+
+void VTParser::reply(const char *s, size_t len) {
+  if (_reply)
+    _reply(s, len, _reply_ctx);
+}
+
+void VTParser::esc_dispatch(uint8_t c) {
+  if (_ninter == 1) {
+    if (_inter[0] == '#' && c == '8') {
+      _screen.fill_test_pattern(); // DECALN
+    } else if (_inter[0] == '(' || _inter[0] == ')') {
+      _g_dec_graphics[_inter[0] == ')'] = (c == '0');
+    }
+    return;
+  }
+  if (_ninter)
+    return;
+
+  switch (c) {
+  case '7': // DECSC
+    _screen.save_cursor();
+    break;
+  case '8': // DECRC
+    _screen.restore_cursor();
+    break;
+  case 'D': // IND
+    _screen.line_feed();
+    break;
+  case 'E': // NEL
+    _screen.carriage_return();
+    _screen.line_feed();
+    break;
+  case 'H': // HTS
+    _screen.set_tab_stop();
+    break;
+  case 'M': // RI
+    _screen.reverse_index();
+    break;
+  case 'c': // RIS
+    reset();
+    break;
+  case '=': // DECKPAM
+    _app_keypad = true;
+    break;
+  case '>': // DECKPNM
+    _app_keypad = false;
+    break;
+  default:
+    break;
+  }
+}
+
+void VTParser::set_mode(bool on) {
+  for (uint8_t i = 0; i < _nparams; i++) {
+    uint16_t mode = _params[i];
+    if (_private == '?') {
+      switch (mode) {
+      case 1: // DECCKM
+        _app_cursor_keys = on;
+        break;
+      case 6: // DECOM
+        _screen.origin_mode = on;
+        _screen.move_to(0, 0);
+        break;
+      case 7: // DECAWM
+        _screen.autowrap = on;
+        break;
+      case 25: // DECTCEM
+        _screen.set_cursor_visible(on);
+        break;
+      case 47:
+      case 1047:
+        _screen.use_alt_screen(on);
+        break;
+      case 1048:
+        if (on)
+          _screen.save_cursor();
+        else
+          _screen.restore_cursor();
+        break;
+      case 1049:
+        if (on) {
+          _screen.save_cursor();
+          _screen.use_alt_screen(true);
+        } else {
+          _screen.use_alt_screen(false);
+          _screen.restore_cursor();
+        }
+        break;
+      case 2004:
+        _bracketed_paste = on;
+        break;
+      default:
+        break;
+      }
+    } else if (!_private) {
+      if (mode == 4)
+        _screen.insert_mode = on;
+      else if (mode == 20)
+        _screen.newline_mode = on;
+    }
+  }
+}
+
+static uint8_t rgb_to_xterm256(uint16_t r, uint16_t g, uint16_t b) {
+  // Nearest entry in the 6x6x6 colour cube
+  uint8_t q[3];
+  uint16_t v[3] = {r, g, b};
+  for (int i = 0; i < 3; i++) {
+    q[i] = v[i] < 48 ? 0 : v[i] < 115 ? 1 : (uint8_t)((v[i] - 35) / 40);
+    if (q[i] > 5)
+      q[i] = 5;
+  }
+  return 16 + 36 * q[0] + 6 * q[1] + q[2];
+}
+
+void VTParser::select_graphic_rendition() {
+  TermCell &pen = _screen.pen;
+  if (_nparams == 0) {
+    _screen.reset_pen();
+    return;
+  }
+
+  for (uint8_t i = 0; i < _nparams; i++) {
+    uint16_t p = _params[i];
+    if (p == 0) {
+      _screen.reset_pen();
+    } else if (p == 1) {
+      pen.flags |= TERM_ATTR_BOLD;
+    } else if (p == 2) {
+      pen.flags |= TERM_ATTR_DIM;
+    } else if (p == 4) {
+      pen.flags |= TERM_ATTR_UNDERLINE;
+    } else if (p == 7) {
+      pen.flags |= TERM_ATTR_INVERSE;
+    } else if (p == 8) {
+      pen.flags |= TERM_ATTR_HIDDEN;
+    } else if (p == 21 || p == 22) {
+      pen.flags &= ~(TERM_ATTR_BOLD | TERM_ATTR_DIM);
+    } else if (p == 24) {
+      pen.flags &= ~TERM_ATTR_UNDERLINE;
+    } else if (p == 27) {
+      pen.flags &= ~TERM_ATTR_INVERSE;
+    } else if (p == 28) {
+      pen.flags &= ~TERM_ATTR_HIDDEN;
+    } else if ((p >= 30 && p <= 37) || (p >= 90 && p <= 97)) {
+      pen.fg = p >= 90 ? p - 90 + 8 : p - 30;
+      pen.flags &= ~TERM_ATTR_DEFAULT_FG;
+    } else if ((p >= 40 && p <= 47) || (p >= 100 && p <= 107)) {
+      pen.bg = p >= 100 ? p - 100 + 8 : p - 40;
+      pen.flags &= ~TERM_ATTR_DEFAULT_BG;
+    } else if (p == 39) {
+      pen.flags |= TERM_ATTR_DEFAULT_FG;
+    } else if (p == 49) {
+      pen.flags |= TERM_ATTR_DEFAULT_BG;
+    } else if (p == 38 || p == 48) {
+      // Extended colour: 38;5;n (256) or 38;2;r;g;b (truecolour)
+      uint8_t idx;
+      if (i + 2 < _nparams && _params[i + 1] == 5) {
+        idx = (uint8_t)_params[i + 2];
+        i += 2;
+      } else if (i + 4 < _nparams && _params[i + 1] == 2) {
+        idx = rgb_to_xterm256(_params[i + 2], _params[i + 3], _params[i + 4]);
+        i += 4;
+      } else {
+        break;
+      }
+      if (p == 38) {
+        pen.fg = idx;
+        pen.flags &= ~TERM_ATTR_DEFAULT_FG;
+      } else {
+        pen.bg = idx;
+        pen.flags &= ~TERM_ATTR_DEFAULT_BG;
+      }
+    }
+  }
+}
+
+void VTParser::csi_dispatch(uint8_t c) {
+  char buf[24];
+
+  if (_ninter) {
+    if (_inter[0] == '!' && c == 'p') { // DECSTR soft reset
+      _screen.reset_pen();
+      _screen.insert_mode = false;
+      _screen.origin_mode = false;
+      _screen.autowrap = true;
+      _screen.set_cursor_visible(true);
+      _screen.set_scroll_region(0, _screen.rows() - 1);
+      _app_cursor_keys = false;
+    }
+    return; // DECSCUSR and friends are not applicable
+  }
+
+  if (_private == '>' || _private == '=' || _private == '<') {
+    if (_private == '>' && c == 'c')
+      reply("\x1b[>0;10;0c", 11); // Secondary DA
+    return;
+  }
+
+  int row = _screen.cursor_row();
+  int col = _screen.cursor_col();
+
+  switch (c) {
+  case '@': // ICH
+    _screen.insert_chars(arg(0, 1));
+    break;
+  case 'A': // CUU
+    _screen.move_rel(-arg(0, 1), 0);
+    break;
+  case 'B': // CUD
+  case 'e': // VPR
+    _screen.move_rel(arg(0, 1), 0);
+    break;
+  case 'C': // CUF
+  case 'a': // HPR
+    _screen.move_rel(0, arg(0, 1));
+    break;
+  case 'D': // CUB
+    _screen.move_rel(0, -arg(0, 1));
+    break;
+  case 'E': // CNL
+    _screen.move_rel(arg(0, 1), 0);
+    _screen.carriage_return();
+    break;
+  case 'F': // CPL
+    _screen.move_rel(-arg(0, 1), 0);
+    _screen.carriage_return();
+    break;
+  case 'G': // CHA
+  case '`': // HPA
+    _screen.move_rel(0, (arg(0, 1) - 1) - col);
+    break;
+  case 'H': // CUP
+  case 'f': // HVP
+    _screen.move_to(arg(0, 1) - 1, arg(1, 1) - 1);
+    break;
+  case 'I': // CHT
+    _screen.tab(arg(0, 1));
+    break;
+  case 'Z': // CBT
+    _screen.back_tab(arg(0, 1));
+    break;
+  case 'J': // ED / DECSED
+    if (arg(0, 0) <= 3)
+      _screen.erase_in_display(arg(0, 0));
+    break;
+  case 'K': // EL / DECSEL
+    _screen.erase_in_line(arg(0, 0));
+    break;
+  case 'L': // IL
+    _screen.insert_lines(arg(0, 1));
+    break;
+  case 'M': // DL
+    _screen.delete_lines(arg(0, 1));
+    break;
+  case 'P': // DCH
+    _screen.delete_chars(arg(0, 1));
+    break;
+  case 'S': // SU
+    _screen.scroll_up(arg(0, 1));
+    break;
+  case 'T': // SD (the 5-parameter form is mouse tracking)
+    if (_nparams <= 1)
+      _screen.scroll_down(arg(0, 1));
+    break;
+  case 'X': // ECH
+    _screen.erase_chars(arg(0, 1));
+    break;
+  case 'b': // REP
+    for (uint16_t n = arg(0, 1); n > 0 && _last_cp; n--)
+      _screen.put(_last_cp);
+    break;
+  case 'c': // Primary DA: VT100 with advanced video option
+    if (!_private && arg(0, 0) == 0)
+      reply("\x1b[?1;2c", 7);
+    break;
+  case 'd': // VPA
+    _screen.move_to(arg(0, 1) - 1, col);
+    break;
+  case 'g': // TBC
+    if (arg(0, 0) == 0)
+      _screen.clear_tab_stop(false);
+    else if (arg(0, 0) == 3)
+      _screen.clear_tab_stop(true);
+    break;
+  case 'h': // SM / DECSET
+    set_mode(true);
+    break;
+  case 'l': // RM / DECRST
+    set_mode(false);
+    break;
+  case 'm': // SGR
+    if (!_private)
+      select_graphic_rendition();
+    break;
+  case 'n': // DSR
+    if (_private)
+      break;
+    if (arg(0, 0) == 5) {
+      reply("\x1b[0n", 4);
+    } else if (arg(0, 0) == 6) {
+      // CPR: relative to the margins in origin mode, as CUP takes it
+      if (_screen.origin_mode)
+        row -= _screen.scroll_top();
+      int len = snprintf(buf, sizeof(buf), "\x1b[%d;%dR", row + 1, col + 1);
+      reply(buf, len);
+    }
+    break;
+  case 'r': // DECSTBM
+    if (!_private)
+      _screen.set_scroll_region(arg(0, 1) - 1, arg(1, _screen.rows()) - 1);
+    break;
+  case 's': // SCOSC
+    if (!_private)
+      _screen.save_cursor();
+    break;
+  case 'u': // SCORC
+    if (!_private)
+      _screen.restore_cursor();
+    break;
+  default:
+    break;
+  }
+}
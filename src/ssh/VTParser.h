@@ -0,0 +1,125 @@
+#ifndef VT_PARSER_H
+#define VT_PARSER_H
+
+#include "TerminalGrid.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * VTParser
+ * Streaming VT100/xterm escape-sequence parser after Paul Williams' DEC
+ * state machine (vt100.net/emu/dec_ansi_parser). Transitions come from a
+ * static [state][byte] table; all parser state (including partially
+ * received sequences and UTF-8) is kept between feed() calls, so sequences
+ * split across recv() buffers are handled. Nothing is allocated per byte.
+ *
+ * The parser owns the screen model it drives: cursor, erase and attribute
+ * actions are applied directly to its TerminalGrid.
+ */
+
+#define VT_MAX_PARAMS 16
+#define VT_MAX_INTERMEDIATES 2
+#ifndef VT_LOCAL_HOLD
+#define VT_LOCAL_HOLD 512 // Local text held while a host sequence is open
+#endif
+
+class VTParser {
+public:
+  // Called for terminal replies (DA, DSR/CPR); write these back to the host
+  typedef void (*ReplyFn)(const char *data, size_t len, void *ctx);
+
+  VTParser();
+
+  void feed(const char *data, size_t len);
+  void reset();
+
+  // Local text (status messages): plain UTF-8, '\n' starts a new line.
+  // Written through TerminalGrid::begin_local() so the host's pen, margins
+  // and screen are untouched; held until the host stream is between
+  // sequences if a feed() ended inside one.
+  void write_local(const char *text, size_t len);
+  bool at_ground() const { return _state == GROUND && !_utf8_left; }
+
+  TerminalGrid &screen() { return _screen; }
+  const TerminalGrid &screen() const { return _screen; }
+
+  void set_reply_handler(ReplyFn fn, void *ctx) {
+    _reply = fn;
+    _reply_ctx = ctx;
+  }
+
+  // DECCKM / DECKPAM state for the key encoder
+  bool app_cursor_keys() const { return _app_cursor_keys; }
+  bool app_keypad() const { return _app_keypad; }
+  bool bracketed_paste() const { return _bracketed_paste; }
+
+  enum State : uint8_t {
+    GROUND = 0,
+    ESCAPE,
+    ESCAPE_INTERMEDIATE,
+    CSI_ENTRY,
+    CSI_PARAM,
+    CSI_INTERMEDIATE,
+    CSI_IGNORE,
+    DCS_ENTRY,
+    DCS_PARAM,
+    DCS_INTERMEDIATE,
+    DCS_PASSTHROUGH,
+    DCS_IGNORE,
+    OSC_STRING,
+    SOS_PM_APC_STRING,
+    STATE_COUNT
+  };
+
+private:
+  TerminalGrid _screen;
+  State _state = GROUND;
+
+  uint16_t _params[VT_MAX_PARAMS];
+  uint8_t _nparams = 0;
+  bool _param_started = false;
+  char _inter[VT_MAX_INTERMEDIATES];
+  uint8_t _ninter = 0;
+  char _private = 0; // '?', '>', '=' or '<' leading a CSI
+
+  uint32_t _utf8_cp = 0;
+  uint8_t _utf8_left = 0;
+  uint32_t _last_cp = 0; // For REP
+
+  // Character sets: G0/G1 designations and which one is shifted in
+  bool _g_dec_graphics[2] = {false, false};
+  uint8_t _gl = 0;
+
+  bool _app_cursor_keys = false;
+  bool _app_keypad = false;
+  bool _bracketed_paste = false;
+
+  ReplyFn _reply = nullptr;
+  void *_reply_ctx = nullptr;
+
+  // Local text: its own UTF-8 state, and what waits for ground state
+  uint32_t _local_cp = 0;
+  uint8_t _local_left = 0;
+  char _held[VT_LOCAL_HOLD];
+  uint16_t _held_len = 0;
+
+  void transition(State next);
+  void do_action(uint8_t action, uint8_t c);
+  void clear_sequence();
+  void print(uint32_t cp);
+  void execute(uint8_t c);
+  void collect(uint8_t c);
+  void param(uint8_t c);
+  void esc_dispatch(uint8_t c);
+  void csi_dispatch(uint8_t c);
+  void set_mode(bool on);
+  void select_graphic_rendition();
+  void reply(const char *s, size_t len);
+  void put_local(const char *text, size_t len);
+
+  uint16_t arg(uint8_t i, uint16_t def) const {
+    return (i < _nparams && _params[i]) ? _params[i] : def;
+  }
+};
+
+#endif // VT_PARSER_H
@@ -7,14 +7,25 @@
  */
 
 #include "ssh_terminal.h"
+#include "../boot/BootTrace.h"
+#include "../hal/AnimScheduler.h"
+#include "../hal/DisplayPipeline.h"
 #include "../hal/void_hal.h"
 #include <LilyGoLib.h>
+#include <FFat.h>
 #include <Preferences.h>
+#include <errno.h>
 #include <esp_timer.h>
 #include <stdlib.h>
+#include <sys/select.h>
 
 static const char *TAG = "SSH_TERMINAL";
 static Preferences preferences;
+// Boot jobs on the other core share the Preferences object with the UI
+static SemaphoreHandle_t prefs_mutex = nullptr;
+
+static void prefs_lock() { xSemaphoreTake(prefs_mutex, portMAX_DELAY); }
+static void prefs_unlock() { xSemaphoreGive(prefs_mutex); }
 SSHTerminal *SSHTerminal::ssht_instance = nullptr;
 
 // Access to the global LilyGo instance for vibration
@@ -38,16 +49,57 @@ extern LilyGoLoRaPager &instance;
 #define INPUT_BAR_HEIGHT 32
 #define CORNER_RADIUS 8 // Rounded corners for premium feel
 
+// Receive path
+#define RX_IDLE_TIMEOUT_MS 250      // select() timeout, bounds disconnect time
+#define RX_DRAIN_BUDGET (16 * 1024) // Bytes per wake before yielding
+#define RX_RING_SIZE (64 * 1024)    // PSRAM ring between ssh_rx and LVGL
+#define UI_DRAIN_BUDGET (8 * 1024)  // Bytes parsed per LVGL callback
+#define UI_CHECKOUT_WAIT_MS 50      // Max wait for a free UI message slot
+#define SSH_KEEPALIVE_MS 30000      // Idle gap before a keepalive, off screen
+#define RX_STALL_POLL_MS 10         // Re-check a full ring this often
+
+// Outcome of one receive pass over a session
+#define RX_IDLE 0    // Drained, wait on the socket
+#define RX_BUSY 1    // Budget used up, more is waiting
+#define RX_STALLED 2 // Ring full, wait for the UI
+#define RX_ENDED 3   // Shell gone
+
+// Persistent log (FFat partition); see load_persistent
+#define PERSIST_LOG_PATH "/ssh_term.log"
+#define PERSIST_FLUSH_MS 5000     // Batched records reach flash this often
+#define PERSIST_SNAPSHOT_MS 30000 // Min gap between session snapshots
+#define LOG_HIST_ADD 1            // Command run (moves it to newest)
+#define LOG_HIST_DEL 2            // Command deleted from history
+#define LOG_SESSION 3             // Screen text snapshot, latest wins
+
 SSHTerminal::SSHTerminal() {
   ssht_instance = this;
-  load_history();
-  load_session();
+  // Constructed from setup(), which runs on the same task as loop()
+  ui_task_handle = xTaskGetCurrentTaskHandle();
+  ui_mailbox.set_consumer(ui_task_handle);
+  for (int i = 0; i < SSH_MAX_SESSIONS; i++)
+    sessions[i].vt.set_reply_handler(vt_reply_cb, &sessions[i]);
+  // Slot 0 is the console; the others get their buffers on first use
+  sessions[0].rx_ring.begin(RX_RING_SIZE);
+  rx_mutex = xSemaphoreCreateMutex();
+  esp_timer_create_args_t tail = {};
+  tail.callback = out_tail_cb;
+  tail.arg = this;
+  tail.name = "rx_tail";
+  esp_timer_create(&tail, &out_tail_timer);
+  conn.begin(this);
+  if (!prefs_mutex)
+    prefs_mutex = xSemaphoreCreateMutex();
+  persist_mutex = xSemaphoreCreateMutex();
+  // History, session and profiles are loaded by boot jobs (preload_*), or
+  // on first use if those have not finished
 }
 
 SSHTerminal::~SSHTerminal() {
   save_history();
   save_session();
-  disconnect();
+  for (int i = 0; i < SSH_MAX_SESSIONS; i++)
+    close_session(i);
   wifi_disconnect();
 }
 
@@ -128,19 +180,23 @@ lv_obj_t *SSHTerminal::create_terminal_screen() {
   lv_obj_set_style_border_width(output_container, 0, 0);
   lv_obj_set_style_radius(output_container, 0, 0);
   lv_obj_set_style_pad_all(output_container, 8, 0);
-  lv_obj_set_scroll_dir(output_container, LV_DIR_VER);
-  lv_obj_set_scrollbar_mode(output_container, LV_SCROLLBAR_MODE_AUTO);
-
-  output_label = lv_label_create(output_container);
-  lv_obj_set_width(output_label, LV_PCT(100));
-  lv_obj_set_style_text_color(output_label, COLOR_FG, 0);
-  lv_obj_set_style_text_font(output_label, &lv_font_montserrat_14,
-                             0); // Clarity increase
-  lv_obj_set_style_text_line_space(output_label, 4,
-                                   0);          // Decouple "squished" lines
-  lv_obj_set_style_pad_hor(output_label, 5, 0); // Internal margin
-  lv_label_set_long_mode(output_label, LV_LABEL_LONG_WRAP);
-  lv_label_set_text(output_label, "");
+
+  lv_obj_clear_flag(output_container, LV_OBJ_FLAG_SCROLLABLE);
+
+  // Cell-grid terminal view; the grid is sized to what fits on screen and
+  // that size is what connect() requests as the PTY
+  TermSession &console = sessions[0];
+  output_view = term_view.create(output_container, &console.vt.screen(),
+                                 &lv_font_montserrat_12);
+  term_view.set_theme(COLOR_FG, COLOR_BG);
+  term_view.fit(term_cols, term_rows);
+  console.vt.screen().resize(term_cols, term_rows);
+  if (console.scrollback.begin(term_cols)) {
+    console.vt.screen().set_scrollback(&console.scrollback);
+    term_view.set_scrollback(&console.scrollback);
+    console.search.begin(&console.scrollback);
+  }
+  term_view.sync();
 
   // ═══════════════════════════════════════════════════════════════════════
   // INPUT BAR - Bottom command line, white text on dim background
@@ -186,6 +242,10 @@ lv_obj_t *SSHTerminal::create_terminal_screen() {
   lv_anim_set_repeat_count(&a_cursor, LV_ANIM_REPEAT_INFINITE);
   lv_anim_start(&a_cursor);
 
+  // Close keypress latency samples once the frame has been flushed
+  lv_display_add_event_cb(lv_display_get_default(), display_refr_ready_cb,
+                          LV_EVENT_REFR_READY, this);
+
   return terminal_screen;
 }
 
@@ -217,7 +277,7 @@ lv_obj_t *SSHTerminal::create_launcher_screen() {
     lv_anim_set_time(&a_grid, 5000);
     lv_anim_set_delay(&a_grid, i * 333);
     lv_anim_set_repeat_count(&a_grid, LV_ANIM_REPEAT_INFINITE);
-    lv_anim_start(&a_grid);
+    AnimScheduler::start(&a_grid, true); // Frozen lines stay put
   }
 
   // 2. VIGNETTE EFFECT (Second Layer)
@@ -250,7 +310,7 @@ lv_obj_t *SSHTerminal::create_launcher_screen() {
   lv_anim_set_time(&a_flicker, 800);
   lv_anim_set_playback_time(&a_flicker, 50);
   lv_anim_set_repeat_count(&a_flicker, LV_ANIM_REPEAT_INFINITE);
-  lv_anim_start(&a_flicker);
+  AnimScheduler::start(&a_flicker, true, 255); // Frozen fully lit
 
   lv_obj_t *subtitle = lv_label_create(launcher_screen);
   lv_obj_set_style_text_color(subtitle, COLOR_DIM, 0);
@@ -332,149 +392,135 @@ lv_obj_t *SSHTerminal::create_launcher_screen() {
 }
 
 void SSHTerminal::show_launcher() {
-  lv_async_call(async_show_launcher_cb, NULL);
-}
-
-void SSHTerminal::async_show_launcher_cb(void *param) {
-  if (!ssht_instance || !ssht_instance->launcher_screen)
-    return;
-  lvgl_lock();
-  ssht_instance->in_launcher = true;
-  lv_scr_load(ssht_instance->launcher_screen);
-  lvgl_unlock();
+  ui_mailbox.request_screen(UI_SCREEN_LAUNCHER);
 }
 
 void SSHTerminal::show_terminal() {
-  lv_async_call(async_show_terminal_cb, NULL);
-}
-
-void SSHTerminal::async_show_terminal_cb(void *param) {
-  if (!ssht_instance || !ssht_instance->terminal_screen)
-    return;
-  lvgl_lock();
-  lv_screen_load_anim(ssht_instance->terminal_screen, LV_SCR_LOAD_ANIM_FADE_ON,
-                      200, 0, false);
-  lv_group_focus_obj(ssht_instance->output_label);
-  ssht_instance->in_launcher = false;
-  lvgl_unlock();
+  ui_mailbox.request_screen(UI_SCREEN_TERMINAL);
 }
 
 void SSHTerminal::append_text(const char *text) {
   if (!text)
     return;
 
-  // Decouple from background tasks using pooled messages
-  UIMessage *msg = ssht_instance->ui_queue.checkout();
-  if (!msg)
-    return;
-
-  strncpy(msg->text, text, MAX_ASYNC_TEXT - 1);
-  msg->text[MAX_ASYNC_TEXT - 1] = '\0';
-  msg->clear = false;
-  lv_async_call(async_append_text_cb, msg);
+  // Merged into the pending mailbox text; background tasks may wait briefly
+  // for a pool slot, the UI task never blocks on itself.
+  bool on_ui_task = xTaskGetCurrentTaskHandle() == ui_task_handle;
+  ui_mailbox.post_text(text, on_ui_task ? 0 : UI_CHECKOUT_WAIT_MS);
 }
 
-void SSHTerminal::async_append_text_cb(void *param) {
-  UIMessage *msg = (UIMessage *)param;
-  if (!msg || !ssht_instance || !ssht_instance->output_label) {
-    if (msg)
-      ssht_instance->ui_queue.release(msg);
-    return;
-  }
-
-  lvgl_lock();
-  ssht_instance->cumulative_text += msg->text;
-
-  // Keep terminal buffer within reasonable limits (4KB)
-  if (ssht_instance->cumulative_text.size() > 4096) {
-    ssht_instance->cumulative_text = ssht_instance->cumulative_text.substr(
-        ssht_instance->cumulative_text.size() - 2048);
-  }
-
-  lv_label_set_text(ssht_instance->output_label,
-                    ssht_instance->cumulative_text.c_str());
-
-  // Scroll to bottom
-  lv_obj_scroll_to_y(lv_obj_get_parent(ssht_instance->output_label),
-                     LV_COORD_MAX, LV_ANIM_ON);
-  lvgl_unlock();
-
-  ssht_instance->ui_queue.release(msg);
+void SSHTerminal::mailbox_text_sink(const char *text, size_t len,
+                                    void *ctx) {
+  SSHTerminal *t = (SSHTerminal *)ctx;
+  t->cur().vt.write_local(text, len);
 }
 
 void SSHTerminal::update_status_bar() {
-  char *buf = (char *)malloc(64);
-  if (!buf)
-    return;
+  char buf[UI_STATUS_LEN];
 
-  // Refresh and get battery info via HAL
-  VOID_HAL::refreshPower();
-  float volt = VOID_HAL::getBatteryVoltage();
-  int percent = VOID_HAL::getBatteryPercent();
+  // Latest sampler snapshot, no I2C here
+  VOID_HAL::PowerSnapshot power = VOID_HAL::getPower();
 
   const char *wifi_status = wifi_connected ? "ONLINE" : "OFFLINE";
   if (is_connecting)
     wifi_status = "BUSY...";
 
-  snprintf(buf, 64,
-           "#FFD700 " LV_SYMBOL_BATTERY_3
-           " %d%% (%.2fV) #  #00FF00 " LV_SYMBOL_WIFI " %s #",
-           percent, volt, wifi_status);
+  int len = snprintf(buf, sizeof(buf),
+                     "#FFD700 " LV_SYMBOL_BATTERY_3
+                     " %d%% (%.2fV) #  #00FF00 " LV_SYMBOL_WIFI " %s #",
+                     power.percent, power.voltage, wifi_status);
+  // Which session slot is on screen, once more than one is in use
+  if ((sessions_open() > 1 || active != 0) && len > 0 &&
+      len < (int)sizeof(buf))
+    snprintf(buf + len, sizeof(buf) - len, " #FFFFFF S%u/%u #",
+             (unsigned)active + 1, (unsigned)SSH_MAX_SESSIONS);
+
+  ui_mailbox.set_status(buf);
+}
 
-  // Pass formatted string to main thread
-  lv_async_call(async_update_status_cb, buf);
+void SSHTerminal::update_input_display() {
+  char buf[UI_INPUT_LEN];
+  snprintf(buf, sizeof(buf), "> %s", input_line.c_str());
+  ui_mailbox.set_input(buf);
 }
 
-void SSHTerminal::async_update_status_cb(void *param) {
-  char *buf = (char *)param;
-  if (!buf || !ssht_instance || !ssht_instance->status_bar) {
-    if (buf)
-      free(buf);
+void SSHTerminal::display_refr_ready_cb(lv_event_t *e) {
+  SSHTerminal *t = (SSHTerminal *)lv_event_get_user_data(e);
+  if (!t || !t->key_paint_stamp_us)
     return;
-  }
-
-  lvgl_lock();
-  lv_label_set_text(ssht_instance->status_bar, buf);
-  lvgl_unlock();
-
-  free(buf);
+  t->key_latency.record(esp_timer_get_time() - t->key_paint_stamp_us);
+  t->key_paint_stamp_us = 0;
 }
 
-void SSHTerminal::async_update_counter_cb(void *param) {
-  char *buf = (char *)param;
-  if (!buf || !ssht_instance || !ssht_instance->byte_counter_label) {
-    if (buf)
-      free(buf);
+void SSHTerminal::service_ui() {
+  uint32_t work = ui_mailbox.take();
+  if (!work)
     return;
-  }
-  lvgl_lock();
-  lv_label_set_text(ssht_instance->byte_counter_label, buf);
-  lvgl_unlock();
-  free(buf);
-}
 
-void SSHTerminal::update_input_display() {
-  std::string *input_ptr = new std::string("> " + current_input);
-  lv_async_call(async_update_input_cb, input_ptr);
-}
+  // Slot state only; the receive task closes the handles
+  if (work & UI_DIRTY_SESSION)
+    on_session_ended();
 
-void SSHTerminal::async_update_input_cb(void *param) {
-  std::string *input = (std::string *)param;
-  if (!input || !ssht_instance || !ssht_instance->input_label) {
-    if (input)
-      delete input;
-    return;
-  }
   lvgl_lock();
-  lv_label_set_text(ssht_instance->input_label, input->c_str());
+  if (work & UI_DIRTY_SWITCH) {
+    apply_switch(ui_mailbox.requested_session());
+    work |= UI_DIRTY_TEXT; // Repaint from the new grid below
+  }
+  if (work & UI_DIRTY_LIVE)
+    set_scroll_mode(false);
+  else if ((work & UI_DIRTY_SEARCH) && scroll_mode)
+    apply_search();
+  if (work & UI_DIRTY_SCREEN) {
+    if (ui_mailbox.requested_screen() == UI_SCREEN_TERMINAL) {
+      load_persistent();
+      if (!restored_session.empty()) {
+        cur().vt.write_local(restored_session.c_str(),
+                             restored_session.size());
+        cur().vt.write_local("\n", 1);
+        std::string().swap(restored_session);
+        work |= UI_DIRTY_TEXT; // Sync the grid below
+      }
+      if (terminal_screen) {
+        lv_screen_load_anim(terminal_screen, LV_SCR_LOAD_ANIM_FADE_ON, 200, 0,
+                            false);
+        lv_group_focus_obj(output_view);
+        in_launcher = false;
+      }
+    } else if (launcher_screen) {
+      in_launcher = true;
+      lv_scr_load(launcher_screen);
+    }
+  }
+
+  // Local text first, then PTY bytes; one grid sync covers both
+  if (work & UI_DIRTY_TEXT)
+    ui_mailbox.drain_text(mailbox_text_sink, this);
+  if (work & UI_DIRTY_RX)
+    drain_rx();
+  if ((work & (UI_DIRTY_TEXT | UI_DIRTY_RX)) && output_view)
+    term_view.sync();
+
+  if ((work & UI_DIRTY_STATUS) && status_bar) {
+    char buf[UI_STATUS_LEN];
+    ui_mailbox.copy_status(buf, sizeof(buf));
+    lv_label_set_text(status_bar, buf);
+  }
+  if ((work & UI_DIRTY_INPUT) && input_label) {
+    char buf[UI_INPUT_LEN];
+    ui_mailbox.copy_input(buf, sizeof(buf));
+    lv_label_set_text(input_label, buf);
+    // Keypress latency is closed by the next display refresh
+    if (key_stamp_us && !in_launcher)
+      key_paint_stamp_us = key_stamp_us;
+    key_stamp_us = 0;
+  }
   lvgl_unlock();
-  delete input;
 }
 
 void SSHTerminal::clear_terminal() {
   lvgl_lock();
-  cumulative_text.clear();
-  lv_label_set_text(output_label, "");
+  cur().vt.screen().clear();
+  term_view.sync();
   lvgl_unlock();
 }
 
@@ -487,38 +533,72 @@ void SSHTerminal::launcher_event_cb(lv_event_t *e) {
   lv_obj_t *obj = (lv_obj_t *)lv_event_get_target(e);
   if (ssht_instance) {
     lvgl_lock();
-    ssht_instance->trigger_glitch(lv_scr_act()); // Glitch the whole screen!
+    // Only the button: a transformed screen is re-rendered whole each step
+    ssht_instance->trigger_glitch(obj);
     ssht_instance->vibrate(60);
     ssht_instance->connect_to_profile(type);
     lvgl_unlock();
   }
 }
 
-void SSHTerminal::save_wg_config(const char *private_key,
+// The private key is sealed by KeyStore like profile passwords. False if
+// it could not be sealed; the old config is dropped then.
+bool SSHTerminal::save_wg_config(const char *private_key,
                                  const char *public_key, const char *endpoint,
                                  const char *local_ip) {
+  prefs_lock();
   preferences.begin("wg", false);
-  preferences.putString("priv", private_key);
-  preferences.putString("pub", public_key);
-  preferences.putString("end", endpoint);
-  preferences.putString("ip", local_ip);
+  preferences.remove("priv"); // Plaintext, from older firmware
+  bool ok = KeyStore::put_secret(preferences, "priv_s", private_key);
+  if (ok) {
+    preferences.putString("pub", public_key);
+    preferences.putString("end", endpoint);
+    preferences.putString("ip", local_ip);
+  } else {
+    preferences.clear();
+  }
   preferences.end();
+  wg_cached = false;
+  prefs_unlock();
+  return ok;
 }
 
+// False until 'save wg' has stored a complete config
 bool SSHTerminal::load_wg_config(WireGuardConfig &config) {
+  prefs_lock();
+  if (wg_cached) {
+    config = wg_cache;
+    prefs_unlock();
+    return true;
+  }
   preferences.begin("wg", true);
-  config.private_key = preferences.getString("priv", "").c_str();
+  config.private_key.clear();
+  bool legacy = false;
+  if (preferences.isKey("priv_s")) {
+    if (!KeyStore::get_secret(preferences, "priv_s", config.private_key))
+      Serial.println("[WG] Stored private key could not be unsealed");
+  } else if (preferences.isKey("priv")) {
+    config.private_key = preferences.getString("priv", "").c_str();
+    legacy = true;
+  }
   config.remote_public_key = preferences.getString("pub", "").c_str();
   config.endpoint = preferences.getString("end", "").c_str();
   config.local_ip = preferences.getString("ip", "").c_str();
   preferences.end();
 
-  // Fallback to hardcoded defaults if NVS is empty
-  if (config.private_key.empty()) {
-    config.private_key = "iJxJ5aP8FjseZBH6kD7teEh16pb8GycpsHuA+3+b1XQ=";
-    config.remote_public_key = "mk24FS+YDTEQ4QwUOWj00dXGdng0WRQz3w5dC9FZkyw=";
-    config.endpoint = "188.70.11.115:51820";
-    config.local_ip = "10.0.0.2";
+  // Seal a plaintext key left by older firmware
+  if (legacy && !config.private_key.empty()) {
+    preferences.begin("wg", false);
+    if (KeyStore::put_secret(preferences, "priv_s",
+                             config.private_key.c_str()))
+      preferences.remove("priv");
+    preferences.end();
+  }
+
+  if (config.private_key.empty() || config.remote_public_key.empty() ||
+      config.endpoint.empty() || config.local_ip.empty()) {
+    prefs_unlock();
+    return false;
   }
 
   // Parse endpoint port if present (host:port)
@@ -530,169 +610,266 @@ bool SSHTerminal::load_wg_config(WireGuardConfig &config) {
     config.port = 51820; // Default WG port
   }
 
+  wg_cache = config;
+  wg_cached = true;
+  prefs_unlock();
   return true;
 }
 
-void SSHTerminal::save_profile(const char *type, const char *host, int port,
+// Launcher profiles with a cache slot; others always come from NVS
+static int profile_slot(const char *type) {
+  if (strcmp(type, "local") == 0)
+    return 0;
+  if (strcmp(type, "remote") == 0)
+    return 1;
+  return -1;
+}
+
+// The password is sealed by KeyStore; an empty one leaves the profile to
+// the device key. False if a password was given but could not be sealed.
+bool SSHTerminal::save_profile(const char *type, const char *host, int port,
                                const char *user, const char *pass) {
   std::string key = std::string("prof_") + type;
+  prefs_lock();
   preferences.begin(key.c_str(), false);
   preferences.putString("host", host);
   preferences.putInt("port", port);
   preferences.putString("user", user);
-  preferences.putString("pass", pass);
+  preferences.remove("pass"); // Plaintext, from older firmware
+  preferences.remove("pass_s");
+  bool ok = !pass || !*pass ||
+            KeyStore::put_secret(preferences, "pass_s", pass);
   preferences.end();
+  int slot = profile_slot(type);
+  if (slot >= 0)
+    profile_cached[slot] = false;
+  prefs_unlock();
+  return ok;
 }
 
 bool SSHTerminal::load_profile(const char *type, SSHProfile &profile) {
+  int slot = profile_slot(type);
+  prefs_lock();
+  if (slot >= 0 && profile_cached[slot]) {
+    profile = profile_cache[slot];
+    prefs_unlock();
+    return true;
+  }
+
   std::string key = std::string("prof_") + type;
   preferences.begin(key.c_str(), true);
-
-  // Try to load from NVS
-  if (preferences.isKey("host")) {
+  bool found = preferences.isKey("host");
+  bool legacy = false;
+  if (found) {
     profile.host = preferences.getString("host", "").c_str();
     profile.port = preferences.getInt("port", 22);
     profile.user = preferences.getString("user", "").c_str();
-    profile.pass = preferences.getString("pass", "").c_str();
-    preferences.end();
-    return true;
+    profile.pass.clear();
+    if (preferences.isKey("pass_s")) {
+      if (!KeyStore::get_secret(preferences, "pass_s", profile.pass))
+        Serial.println("[PROF] Stored password could not be unsealed");
+    } else if (preferences.isKey("pass")) {
+      profile.pass = preferences.getString("pass", "").c_str();
+      legacy = true;
+    }
   }
   preferences.end();
 
-  // Fallback to hardcoded defaults if NVS is empty
-  if (strcmp(type, "local") == 0) {
-    profile.host = "192.168.1.10";
-    profile.port = 22;
-    profile.user = "archie";
-    profile.pass = "archie";
-    return true;
-  } else if (strcmp(type, "remote") == 0) {
-    profile.host = "10.0.0.1";
-    profile.port = 22;
-    profile.user = "archie";
-    profile.pass = "archie";
-    return true;
+  // Seal a plaintext password left by older firmware
+  if (legacy) {
+    preferences.begin(key.c_str(), false);
+    if (profile.pass.empty() ||
+        KeyStore::put_secret(preferences, "pass_s", profile.pass.c_str()))
+      preferences.remove("pass");
+    preferences.end();
   }
 
-  return false;
+  if (found && slot >= 0) {
+    profile_cache[slot] = profile;
+    profile_cached[slot] = true;
+  }
+  prefs_unlock();
+  return found;
 }
 
-void SSHTerminal::connect_to_profile(const char *type) {
-  if (!type)
-    return; // Safety check
-
-  if (is_connecting) {
-    append_text("[BUSY] Connection in progress...\n");
-    return;
-  }
+void SSHTerminal::preload_profiles() {
+  SSHProfile prof;
+  WireGuardConfig wg_config;
+  load_profile("local", prof);
+  load_profile("remote", prof);
+  load_wg_config(wg_config);
+  resume_enabled();
+  // Unseal and parse the identity now, not on the first connect
+  keys.load();
+  boot_mark("keys");
+}
 
-  if (ssh_connected) {
-    append_text("[INFO] Already connected. Type 'exit' first.\n");
-    return;
+bool SSHTerminal::resume_enabled() {
+  prefs_lock();
+  if (!resume_cached) {
+    preferences.begin("fastconn", true);
+    resume_shell = preferences.getBool("resume", true);
+    preferences.end();
+    resume_cached = true;
   }
+  bool on = resume_shell;
+  prefs_unlock();
+  return on;
+}
 
-  is_connecting = true;
-  vibrate(100);
+void SSHTerminal::set_resume(bool on) {
+  prefs_lock();
+  preferences.begin("fastconn", false);
+  preferences.putBool("resume", on);
+  preferences.end();
+  resume_shell = on;
+  resume_cached = true;
+  prefs_unlock();
+}
 
-  // Use a heap-allocated copy to pass to the task safely
-  char *task_type = strdup(type);
-  if (!task_type) {
-    is_connecting = false;
+void SSHTerminal::show_public_key() {
+  char line[160];
+  if (!keys.public_line(line, sizeof(line) - 1)) {
+    append_text("No key yet: 'keygen', or 'importkey' to load "
+                KEYSTORE_IMPORT_PATH " from FFat.\n");
     return;
   }
-
-  // Increase stack to 16KB for stable SSH negotiation
-  xTaskCreate(connection_task, "ssh_connect", 1024 * 16, (void *)task_type, 5,
-              &connection_task_handle);
+  strcat(line, "\n");
+  append_text(line);
+  append_text(keys.hardware_bound()
+                  ? "Sealed by the eFuse HMAC key.\n"
+                  : "Sealed by a chip-derived key (no HMAC eFuse key).\n");
 }
 
-void SSHTerminal::connection_task(void *param) {
-  char *type_ptr = (char *)param;
-  std::string type = type_ptr;
-  free(type_ptr); // Free the copy immediately after stringifying
-
-  SSHTerminal *ui = ssht_instance;
+int SSHTerminal::find_session(const ConnTarget &target) const {
+  for (int i = 0; i < SSH_MAX_SESSIONS; i++) {
+    const ConnTarget &t = sessions[i].target;
+    if (sessions[i].connected && strcmp(t.host, target.host) == 0 &&
+        t.port == target.port && strcmp(t.user, target.user) == 0 &&
+        t.tunnel == target.tunnel)
+      return i;
+  }
+  return -1;
+}
 
-  ui->show_terminal();
-  ui->append_text("\n[INIT] Requesting Secure Session...\n");
+int SSHTerminal::sessions_open() const {
+  int n = 0;
+  for (int i = 0; i < SSH_MAX_SESSIONS; i++)
+    n += sessions[i].connected ? 1 : 0;
+  return n;
+}
 
-  SSHProfile prof;
-  if (ui->load_profile(type.c_str(), prof)) {
-    if (!ui->wifi_connected) {
-      if (!ui->wifi_auto_connect()) {
-        ui->append_text("[ERROR] Link Offline. Check WiFi.\n");
-        ui->is_connecting = false;
-        ui->connection_task_handle = nullptr;
-        vTaskDelete(NULL);
-        return;
-      }
-    }
+// Slot 0 gets its buffers in create_terminal_screen, the others on first
+// use. LVGL task.
+bool SSHTerminal::prepare_slot(int slot) {
+  TermSession &s = sessions[slot];
+  if (!s.rx_ring.capacity() && !s.rx_ring.begin(RX_RING_SIZE))
+    return false;
+  TerminalGrid &grid = s.vt.screen();
+  if (grid.cols() != term_cols || grid.rows() != term_rows)
+    grid.resize(term_cols, term_rows);
+  // A slot without history still works, it just cannot scroll back
+  if (!s.scrollback.capacity() &&
+      s.scrollback.begin(term_cols, SESSION_SCROLLBACK_LINES)) {
+    grid.set_scrollback(&s.scrollback);
+    s.search.begin(&s.scrollback);
+  }
+  return true;
+}
 
-    if (type == "remote") {
-      if (!ui->wg_connect()) {
-        ui->append_text("[ERROR] Tunnel Failure. Aborting.\n");
-        ui->is_connecting = false;
-        ui->connection_task_handle = nullptr;
-        vTaskDelete(NULL);
-        return;
-      }
-    }
+// Called by the connection manager (LVGL locked) before the PTY request
+void SSHTerminal::prepare_pty() {
+  int slot = connecting_slot >= 0 ? connecting_slot : active;
+  TerminalGrid &grid = sessions[slot].vt.screen();
+  if (grid.cols() != term_cols || grid.rows() != term_rows)
+    grid.resize(term_cols, term_rows);
+}
 
-    ui->append_text("Negotiating SSH Handshake...\n");
-    bool success = ui->connect(prof.host.c_str(), prof.port, prof.user.c_str(),
-                               prof.pass.c_str());
-    if (!success) {
-      ui->append_text("[ERROR] SSH Negotiation Failed.\n");
-    }
-  } else {
-    ui->append_text("[ERROR] Profile Not Found.\n");
-  }
+void SSHTerminal::switch_session(int slot) {
+  if (slot >= 0 && slot < SSH_MAX_SESSIONS)
+    ui_mailbox.request_session(slot);
+}
 
-  ui->is_connecting = false;
-  ui->connection_task_handle = nullptr;
-  vTaskDelete(NULL);
+void SSHTerminal::apply_switch(int slot) {
+  if (slot == active || !prepare_slot(slot))
+    return;
+  set_scroll_mode(false); // Search state belongs to the old history
+  active = slot;
+  TermSession &s = cur();
+  term_view.attach(&s.vt.screen(),
+                   s.scrollback.capacity() ? &s.scrollback : nullptr);
+  update_byte_counter();
+  update_status_bar();
 }
 
-bool SSHTerminal::wg_connect() {
-  WireGuardConfig config;
-  if (!load_wg_config(config)) {
-    append_text("Error: WireGuard config not found.\n");
+// Pick a slot for a new shell: the one on screen if it is free, else the
+// first free one. It is shown at once so progress lands on its screen.
+bool SSHTerminal::open_session(const ConnTarget &target) {
+  if (conn.busy()) {
+    append_text("[BUSY] Connection in progress...\n");
+    return false;
+  }
+  int slot = cur().connected ? -1 : active;
+  for (int i = 0; i < SSH_MAX_SESSIONS && slot < 0; i++) {
+    if (!sessions[i].connected)
+      slot = i;
+  }
+  if (slot < 0) {
+    append_text("[FULL] All sessions in use. Close one with ~.\n");
+    return false;
+  }
+  if (!prepare_slot(slot)) {
+    append_text("[ERROR] No memory for another session.\n");
     return false;
   }
 
-  append_text("Establishing WireGuard Tunnel...\n");
-
-  IPAddress local_ip;
-  if (!local_ip.fromString(config.local_ip.c_str())) {
-    append_text("Error: Invalid WireGuard Local IP.\n");
+  connecting_slot = slot;
+  if (!conn.request_session(target)) {
+    append_text("[BUSY] Connection in progress...\n");
     return false;
   }
+  switch_session(slot);
+  append_text("\n[INIT] Requesting Secure Session...\n");
+  return true;
+}
 
-  append_text("Configuring tunnel (MTU 1420)...\n");
+void SSHTerminal::connect_to_profile(const char *type) {
+  if (!type)
+    return; // Safety check
 
-  if (wg.begin(local_ip, config.private_key.c_str(), config.endpoint.c_str(),
-               config.remote_public_key.c_str(), config.port)) {
+  if (is_connecting) {
+    append_text("[BUSY] Connection in progress...\n");
+    return;
+  }
 
-    // HANDSHAKE VERIFICATION LOOP
-    append_text("Waiting for Handshake...");
-    int retry = 0;
-    while (!wg.is_initialized() && retry < 10) {
-      append_text(".");
-      vTaskDelay(pdMS_TO_TICKS(500));
-      retry++;
-    }
+  SSHProfile prof;
+  if (!load_profile(type, prof)) {
+    show_terminal();
+    append_text("[ERROR] Profile Not Found. Set it with: save ");
+    append_text(type);
+    append_text(" <host> <port> <user> [pass]\n");
+    return;
+  }
 
-    if (wg.is_initialized()) {
-      append_text("\n[SUCCESS] WireGuard Tunnel active.\n");
-      return true;
-    } else {
-      append_text("\n[FAILED] Handshake timeout.\n");
-      return false;
-    }
-  } else {
-    append_text("WireGuard initialization failed!\n");
-    return false;
+  ConnTarget target = {};
+  strncpy(target.host, prof.host.c_str(), sizeof(target.host) - 1);
+  strncpy(target.user, prof.user.c_str(), sizeof(target.user) - 1);
+  strncpy(target.pass, prof.pass.c_str(), sizeof(target.pass) - 1);
+  target.port = prof.port;
+  target.tunnel = strcmp(type, "remote") == 0;
+
+  // Still open (detached, or in another slot): just show it
+  int slot = find_session(target);
+  if (slot >= 0) {
+    switch_session(slot);
+    show_terminal();
+    append_text("[RESUMED] Session still open, no handshake.\n");
+    return;
   }
+
+  vibrate(100);
+  show_terminal();
+  open_session(target);
 }
 
 void SSHTerminal::wg_disconnect() {
@@ -700,243 +877,223 @@ void SSHTerminal::wg_disconnect() {
   append_text("WireGuard Tunnel DOWN.\n");
 }
 
-bool SSHTerminal::wifi_connect(const char *ssid, const char *password) {
-  append_text("Connecting to WiFi: ");
-  append_text(ssid);
-  append_text("\n");
-
-  WiFi.begin(ssid, password);
-
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && attempts < 30) {
-    delay(500);
-    append_text(".");
-    attempts++;
-  }
-  append_text("\n");
-
-  if (WiFi.status() == WL_CONNECTED) {
-    wifi_connected = true;
-    append_text("WiFi connected! IP: ");
-    append_text(WiFi.localIP().toString().c_str());
-    append_text("\n");
-
-    // RESTORE NTP SYNCHRONIZATION
-    append_text("Synchronizing Time (NTP)...");
-    configTime(0, 0, "pool.ntp.org", "time.nist.gov");
-    time_t now = time(nullptr);
-    int time_wait = 0;
-    while (now < 10000 && time_wait < 15) {
-      delay(500);
-      now = time(nullptr);
-      append_text(".");
-      time_wait++;
-    }
-
-    if (now > 10000) {
-      append_text("\nTime Synced.\n");
-    } else {
-      append_text("\nTime Sync Failed (Handshake may fail).\n");
-    }
-
-    update_status_bar();
-
-    // Save WiFi credentials for auto-connect
-    preferences.begin("wifi", false);
-    preferences.putString("ssid", ssid);
-    preferences.putString("pass", password);
-    preferences.end();
-
-    return true;
-  } else {
-    append_text("WiFi connection failed!\n");
-    return false;
-  }
+void SSHTerminal::wifi_connect(const char *ssid, const char *password) {
+  conn.request_wifi(ssid, password);
 }
 
-bool SSHTerminal::wifi_auto_connect() {
-  preferences.begin("wifi", true);
-  String ssid = preferences.getString("ssid", "");
-  String pass = preferences.getString("pass", "");
-  preferences.end();
+void SSHTerminal::wifi_auto_connect() { conn.request_wifi(nullptr, nullptr); }
 
-  if (ssid != "") {
-    return wifi_connect(ssid.c_str(), pass.c_str());
-  }
+void SSHTerminal::wifi_disconnect() { conn.drop_wifi(); }
 
-  // Fallback to defaults
-  append_text("Trying default WiFi (AAF)...\n");
-  return wifi_connect("AAF", "12345678");
+bool SSHTerminal::connect(const char *host, int port, const char *user,
+                          const char *pass) {
+  ConnTarget target = {};
+  strncpy(target.host, host, sizeof(target.host) - 1);
+  strncpy(target.user, user, sizeof(target.user) - 1);
+  strncpy(target.pass, pass, sizeof(target.pass) - 1);
+  target.port = port;
+  target.tunnel = false;
+  return open_session(target);
 }
 
-void SSHTerminal::wifi_disconnect() {
-  if (wifi_connected) {
-    WiFi.disconnect(true);
-    wifi_connected = false;
-    update_status_bar();
-  }
+void SSHTerminal::cancel_connect() { conn.cancel(); }
+
+// Called by the connection manager once the shell is open
+void SSHTerminal::on_shell_ready(ssh_session new_session,
+                                 ssh_channel new_channel,
+                                 const ConnTarget &target) {
+  int slot = connecting_slot >= 0 ? connecting_slot : active;
+  connecting_slot = -1;
+  TermSession &s = sessions[slot];
+
+  // One receive task serves every slot; start it with the first session
+  xSemaphoreTake(rx_mutex, portMAX_DELAY);
+  s.session = new_session;
+  s.channel = new_channel;
+  s.target = target;
+  s.ended = false;
+  s.link_lost = false;
+  s.last_io_ms = millis();
+  s.connected = true;
+  bool started = start_receive_task();
+  xSemaphoreGive(rx_mutex);
+
+  boot_mark("shell"); // Time-to-shell, first session only
+  append_text(started ? "SSH connected!\n"
+                      : "[ERROR] Receive task failed to start.\n");
+  update_status_bar();
 }
 
-bool SSHTerminal::connect(const char *host, int port, const char *user,
-                          const char *pass) {
-  if (!wifi_connected) {
-    append_text("Error: WiFi not connected!\n");
-    return false;
-  }
-
-  append_text("Connecting to SSH: ");
-  append_text(host);
-  append_text(":");
-  char port_str[8];
-  snprintf(port_str, sizeof(port_str), "%d", port);
-  append_text(port_str);
-  append_text("\n");
-
-  // Initialize SSH session
-  session = ssh_new();
-  if (!session) {
-    append_text("Failed to create SSH session!\n");
-    return false;
-  }
+void SSHTerminal::detach() {
+  show_launcher();
+  append_text("[DETACHED] Sessions kept open; pick a profile to return.\n");
+}
 
-  ssh_options_set(session, SSH_OPTIONS_HOST, host);
-  ssh_options_set(session, SSH_OPTIONS_PORT, &port);
-  ssh_options_set(session, SSH_OPTIONS_USER, user);
-
-  // Set explicit timeout (10 seconds)
-  long timeout_sec = 10;
-  ssh_options_set(session, SSH_OPTIONS_TIMEOUT, &timeout_sec);
-
-  // Connect
-  int rc = ssh_connect(session);
-  if (rc != SSH_OK) {
-    append_text("SSH connection failed: ");
-    append_text(ssh_get_error(session));
-    append_text("\n");
-
-    // Help the user diagnose
-    if (strstr(host, "100.")) {
-      append_text("Tip: Tailscale IPs (100.x.x.x) only work if this WiFi has a "
-                  "Tailscale Subnet Router.\n");
-    } else if (strncmp(host, "192.168.", 8) == 0) {
-      append_text("Tip: Check if your local machine (192.168.x.x) is on the "
-                  "same WiFi (AAF).\n");
+// The receive task saw shells end (EOF) or their links fail. Runs on the
+// LVGL task (UI_DIRTY_SESSION).
+void SSHTerminal::on_session_ended() {
+  for (int i = 0; i < SSH_MAX_SESSIONS; i++) {
+    TermSession &s = sessions[i];
+    if (!s.connected || !s.ended)
+      continue;
+    bool lost = s.link_lost;
+    ConnTarget target = s.target;
+    close_session(i);
+
+    char line[64];
+    if (i == active)
+      snprintf(line, sizeof(line), "SSH disconnected.\n");
+    else
+      snprintf(line, sizeof(line), "[S%d] Session closed.\n", i + 1);
+    append_text(line);
+
+    if (!lost || !resume_enabled())
+      continue;
+    // One request at a time: further drops are left to the user
+    if (conn.busy()) {
+      append_text("[RESUME] Busy, pick the profile to reconnect.\n");
+      continue;
     }
-
-    ssh_free(session);
-    session = nullptr;
-    return false;
-  }
-
-  // Authenticate
-  rc = ssh_userauth_password(session, nullptr, pass);
-  if (rc != SSH_AUTH_SUCCESS) {
-    append_text("SSH authentication failed!\n");
-    ssh_disconnect(session);
-    ssh_free(session);
-    session = nullptr;
-    return false;
-  }
-
-  // Open channel
-  channel = ssh_channel_new(session);
-  if (!channel) {
-    append_text("Failed to create channel!\n");
-    ssh_disconnect(session);
-    ssh_free(session);
-    session = nullptr;
-    return false;
-  }
-
-  rc = ssh_channel_open_session(channel);
-  if (rc != SSH_OK) {
-    append_text("Failed to open channel!\n");
-    ssh_channel_free(channel);
-    ssh_disconnect(session);
-    ssh_free(session);
-    channel = nullptr;
-    session = nullptr;
-    return false;
-  }
-
-  // Request PTY
-  rc = ssh_channel_request_pty_size(channel, "vt100", 80, 24);
-  if (rc != SSH_OK) {
-    append_text("Failed to request PTY!\n");
+    append_text("[RESUME] Link dropped, reconnecting...\n");
+    connecting_slot = i;
+    conn.request_session(target);
   }
-
-  // Start shell
-  rc = ssh_channel_request_shell(channel);
-  if (rc != SSH_OK) {
-    append_text("Failed to start shell!\n");
-    ssh_channel_close(channel);
-    ssh_channel_free(channel);
-    ssh_disconnect(session);
-    ssh_free(session);
-    channel = nullptr;
-    session = nullptr;
-    return false;
-  }
-
-  ssh_connected = true;
-  append_text("SSH connected!\n");
   update_status_bar();
+}
 
-  // Start receive task
-  run_receive_task = true;
-  xTaskCreate(ssh_receive_task, "ssh_rx", 1024 * 16, this, 5,
-              &receive_task_handle);
+// Empty a slot. Its handles go to the receive task, which owns the
+// sessions: closing one can block on a dead link, and must not do so on
+// the LVGL task or next to a read of the same session.
+void SSHTerminal::close_session(int slot) {
+  TermSession &s = sessions[slot];
+  xSemaphoreTake(rx_mutex, portMAX_DELAY);
+  ssh_session session = s.session;
+  ssh_channel channel = s.channel;
+  s.connected = false;
+  s.session = nullptr;
+  s.channel = nullptr;
+  bool handed = !session && !channel;
+  if (!handed && closed_count < SSH_MAX_SESSIONS && start_receive_task()) {
+    closed[closed_count].session = session;
+    closed[closed_count].channel = channel;
+    closed_count++;
+    handed = true;
+  }
+  xSemaphoreGive(rx_mutex);
 
-  return true;
+  // No task to take them: nothing else uses the handles, free them here
+  if (!handed)
+    free_handles(session, channel);
+  s.ended = false;
+  s.link_lost = false;
 }
 
-void SSHTerminal::disconnect() {
-  run_receive_task = false;       // Signal receive task to exit
-  vTaskDelay(pdMS_TO_TICKS(100)); // Give it time to exit gracefully
-  receive_task_handle = nullptr;
+// Start the receive task unless it runs; rx_mutex held
+bool SSHTerminal::start_receive_task() {
+  return receive_task_handle != nullptr ||
+         xTaskCreate(ssh_receive_task, "ssh_rx", 1024 * 16, this, 5,
+                     &receive_task_handle) == pdPASS;
+}
 
+// Best effort: the link may be gone, so nothing here waits for the peer
+void SSHTerminal::free_handles(ssh_session session, ssh_channel channel) {
+  if (session)
+    ssh_set_blocking(session, 0);
   if (channel) {
     ssh_channel_close(channel);
     ssh_channel_free(channel);
-    channel = nullptr;
   }
-
   if (session) {
     ssh_disconnect(session);
     ssh_free(session);
-    session = nullptr;
   }
+}
 
-  ssh_connected = false;
+void SSHTerminal::disconnect() {
+  bool was_open = cur().connected;
+  close_session(active);
   update_status_bar();
-  append_text("SSH disconnected.\n");
+  if (was_open)
+    append_text("SSH disconnected.\n");
 }
 
-void SSHTerminal::send_command(const char *cmd) {
-  if (!ssh_connected || !channel)
-    return;
+// libssh sessions are not thread-safe: the receive task reads them under
+// rx_mutex, so every write takes it too
+void SSHTerminal::write_session(TermSession &s, const char *data,
+                                size_t len) {
+  xSemaphoreTake(rx_mutex, portMAX_DELAY);
+  if (s.connected && s.channel)
+    ssh_channel_write(s.channel, data, len);
+  xSemaphoreGive(rx_mutex);
+}
 
-  ssh_channel_write(channel, cmd, strlen(cmd));
+void SSHTerminal::send_command(const char *cmd) {
+  write_session(cur(), cmd, strlen(cmd));
 }
 
 // Send special control characters (Ctrl+C, Tab, etc.)
 void SSHTerminal::send_special_key(uint8_t key_code) {
-  if (!ssh_connected || !channel)
-    return;
-
   char buf[2] = {(char)key_code, 0};
-  ssh_channel_write(channel, buf, 1);
+  write_session(cur(), buf, 1);
 }
 
 void SSHTerminal::handle_key_input(char key) {
+  key_stamp_us = esp_timer_get_time();
+
+  if (scroll_mode) {
+    // Keys edit the search query; Enter returns to live output
+    if (key == '\n' || key == '\r') {
+      ui_mailbox.mark(UI_DIRTY_LIVE);
+      return;
+    }
+    if (key == 8 || key == 127)
+      search_line.backspace();
+    else if (key >= 32 && key <= 126)
+      search_line.insert(key);
+    ui_mailbox.mark(UI_DIRTY_SEARCH);
+    return;
+  }
+
+  // OpenSSH-style escapes act on the key after a '~' that starts the line:
+  // ~1..~3 and ~n switch sessions, ~h detaches, ~. closes the one on screen
+  if (strcmp(input_line.c_str(), "~") == 0) {
+    bool handled = true;
+    if (key >= '1' && key < '1' + SSH_MAX_SESSIONS) {
+      switch_session(key - '1');
+    } else if (key == 'n') {
+      // Next open session; the first slot (console) is always in the cycle
+      int next = active;
+      for (int i = 1; i < SSH_MAX_SESSIONS; i++) {
+        int slot = (active + i) % SSH_MAX_SESSIONS;
+        if (slot == 0 || sessions[slot].connected) {
+          next = slot;
+          break;
+        }
+      }
+      switch_session(next);
+    } else if (key == 'h' && sessions_open()) {
+      detach();
+    } else if (key == '.' && cur().connected) {
+      disconnect();
+    } else {
+      handled = false;
+    }
+    if (handled) {
+      input_line.clear();
+      update_input_display();
+      return;
+    }
+  }
+
   if (key == '\n' || key == '\r') {
     // Process command
-    if (ssh_connected) {
+    if (cur().connected) {
       // Send to SSH
-      current_input += '\n';
-      send_command(current_input.c_str());
+      send_command(input_line.c_str());
+      send_command("\n");
     } else {
-      // Local command processing
+      // Local command processing (allocates freely, runs once per line)
+      std::string current_input = input_line.c_str();
       append_text("> ");
       append_text(current_input.c_str());
       append_text("\n");
@@ -970,8 +1127,8 @@ void SSHTerminal::handle_key_input(char key) {
         } else {
           append_text("Usage: ssh <HOST> <PORT> <USER> <PASS>\n");
         }
-      } else if (current_input.rfind("save ", 0) == 0) {
-        // Parse: save <local|remote> <host> <port> <user> <pass>
+      } else if (current_input.rfind("save wg ", 0) == 0) {
+        // Parse: save wg <priv> <pub> <endpoint:port> <local_ip>
         std::vector<std::string> parts;
         size_t pos = 0;
         std::string temp = current_input;
@@ -982,18 +1139,15 @@ void SSHTerminal::handle_key_input(char key) {
         parts.push_back(temp);
 
         if (parts.size() >= 6) {
-          save_profile(parts[1].c_str(), parts[2].c_str(),
-                       atoi(parts[3].c_str()), parts[4].c_str(),
-                       parts[5].c_str());
-          append_text("Profile [");
-          append_text(parts[1].c_str());
-          append_text("] saved.\n");
+          append_text(save_wg_config(parts[2].c_str(), parts[3].c_str(),
+                                     parts[4].c_str(), parts[5].c_str())
+                          ? "WireGuard config saved.\n"
+                          : "WireGuard config not saved (sealing failed).\n");
         } else {
-          append_text(
-              "Usage: save <local|remote> <host> <port> <user> <pass>\n");
+          append_text("Usage: save wg <priv> <pub> <end:port> <ip>\n");
         }
-      } else if (current_input.rfind("save wg ", 0) == 0) {
-        // Parse: save wg <priv> <pub> <endpoint:port> <local_ip>
+      } else if (current_input.rfind("save ", 0) == 0) {
+        // Parse: save <local|remote> <host> <port> <user> [pass]
         std::vector<std::string> parts;
         size_t pos = 0;
         std::string temp = current_input;
@@ -1003,212 +1157,530 @@ void SSHTerminal::handle_key_input(char key) {
         }
         parts.push_back(temp);
 
-        if (parts.size() >= 6) {
-          save_wg_config(parts[2].c_str(), parts[3].c_str(), parts[4].c_str(),
-                         parts[5].c_str());
-          append_text("WireGuard config saved.\n");
+        if (parts.size() >= 5 && profile_slot(parts[1].c_str()) >= 0) {
+          bool sealed = save_profile(
+              parts[1].c_str(), parts[2].c_str(), atoi(parts[3].c_str()),
+              parts[4].c_str(), parts.size() >= 6 ? parts[5].c_str() : "");
+          append_text("Profile [");
+          append_text(parts[1].c_str());
+          append_text(sealed ? "] saved.\n"
+                             : "] saved without its password (sealing "
+                               "failed).\n");
         } else {
-          append_text("Usage: save wg <priv> <pub> <end:port> <ip>\n");
+          append_text(
+              "Usage: save <local|remote> <host> <port> <user> [pass]\n");
         }
       } else if (current_input == "home") {
+        if (is_connecting)
+          cancel_connect();
         disconnect();
         show_launcher();
         return; // Skip history for home navigation
       } else if (current_input == "disconnect") {
         wifi_disconnect();
         append_text("WiFi disconnected.\n");
-      } else if (current_input == "exit") {
-        disconnect();
+      } else if (current_input == "exit" || current_input == "cancel") {
+        if (is_connecting)
+          cancel_connect();
+        else if (current_input == "exit")
+          disconnect();
       } else if (current_input == "clear") {
         clear_terminal();
+      } else if (current_input.rfind("resume", 0) == 0) {
+        if (current_input == "resume on")
+          set_resume(true);
+        else if (current_input == "resume off")
+          set_resume(false);
+        else if (current_input != "resume")
+          append_text("Usage: resume [on|off]\n");
+        append_text(resume_enabled()
+                        ? "Resume ON: shells run under tmux/screen and "
+                          "reconnect after a drop.\n"
+                        : "Resume OFF: plain shell, no reconnect.\n");
+      } else if (current_input == "forget") {
+        HostCache::forget_all();
+        append_text("Cached host keys and algorithms cleared.\n");
+      } else if (current_input == "keygen" || current_input == "importkey") {
+        bool gen = current_input == "keygen";
+        if (conn.busy()) {
+          append_text("Wait for the connection attempt to finish.\n");
+        } else if (gen) {
+          append_text("Generating Ed25519 key...\n");
+          if (keys.generate())
+            show_public_key();
+          else
+            append_text("Key generation failed.\n");
+        } else {
+          load_persistent(); // Mounts FFat
+          if (keys.import_file(FFat, KEYSTORE_IMPORT_PATH))
+            show_public_key();
+          else
+            append_text("No usable private key at " KEYSTORE_IMPORT_PATH
+                        " on FFat.\n");
+        }
+      } else if (current_input == "pubkey") {
+        show_public_key();
+      } else if (current_input == "stats") {
+        ByteRing::Stats st = cur().rx_ring.stats();
+        char line[96];
+        snprintf(line, sizeof(line),
+                 "RX %u B, peak %u/%u, dropped %u B (%u), stalls %u\n",
+                 (unsigned)st.written, (unsigned)st.high_water,
+                 (unsigned)cur().rx_ring.capacity(), (unsigned)st.dropped,
+                 (unsigned)st.overflow_events, (unsigned)st.stalls);
+        append_text(line);
+        snprintf(line, sizeof(line), "Sessions %d/%u open, S%u on screen\n",
+                 sessions_open(), (unsigned)SSH_MAX_SESSIONS,
+                 (unsigned)active + 1);
+        append_text(line);
+        UIMessageQueue::Stats qs = ui_mailbox.pool_stats();
+        snprintf(line, sizeof(line),
+                 "UI pool %u/%u in use, peak %u, empty %u, dropped %u\n",
+                 (unsigned)qs.in_use, (unsigned)UI_POOL_SIZE,
+                 (unsigned)qs.high_water, (unsigned)qs.exhaustions,
+                 (unsigned)qs.drops);
+        append_text(line);
+        int len = snprintf(line, sizeof(line), "Key->pixel ");
+        key_latency.format(line + len, sizeof(line) - len - 1);
+        strcat(line, "\n");
+        append_text(line);
+        VOID_HAL::HapticStats hs = VOID_HAL::getHapticStats();
+        snprintf(line, sizeof(line), "Haptics %u requested, %u played\n",
+                 (unsigned)hs.requested, (unsigned)hs.played);
+        append_text(line);
+        VOID_HAL::PowerHistory ph = VOID_HAL::getPowerHistory();
+        snprintf(line, sizeof(line),
+                 "Power %u samples: %.2f-%.2fV avg %.2f, %.0f/%.0f/%.0f mA, "
+                 "%.1f-%.1fC\n",
+                 (unsigned)ph.samples, ph.voltage.min, ph.voltage.max,
+                 ph.voltage.avg, ph.current_ma.min, ph.current_ma.avg,
+                 ph.current_ma.max, ph.temperature_c.min,
+                 ph.temperature_c.max);
+        append_text(line);
+        const Scrollback &sb = cur().scrollback;
+        snprintf(line, sizeof(line), "History %u/%u lines, %u KB PSRAM\n",
+                 (unsigned)sb.count(), (unsigned)sb.capacity(),
+                 (unsigned)(sb.memory_bytes() / 1024));
+        append_text(line);
+        LogStore::Stats ls = session_log.stats();
+        snprintf(line, sizeof(line),
+                 "Log %u B + %u batched, %u flushes, %u compactions\n",
+                 (unsigned)ls.file_bytes, (unsigned)ls.pending,
+                 (unsigned)ls.flushes, (unsigned)ls.compactions);
+        append_text(line);
+        conn.format_timing(line, sizeof(line) - 1);
+        strcat(line, "\n");
+        append_text(line);
+        conn.format_crypto(line, sizeof(line) - 1);
+        strcat(line, "\n");
+        append_text(line);
+        DisplayPipeline::format(line, sizeof(line) - 1);
+        strcat(line, "\n");
+        append_text(line);
+        AnimScheduler::format(line, sizeof(line) - 1);
+        strcat(line, "\n");
+        append_text(line);
+        out_pacer.format(line, sizeof(line) - 1, esp_timer_get_time());
+        strcat(line, "\n");
+        append_text(line);
+        boot_format(line, sizeof(line) - 1);
+        strcat(line, "\n");
+        append_text(line);
       } else if (current_input == "help") {
         append_text("Commands:\n");
         append_text("  connect <SSID> <PASS> - Connect WiFi\n");
         append_text("  ssh <H> <P> <U> <P> - Manual SSH\n");
-        append_text("  save <local|remote> <H> <P> <U> <P> - Save Profile\n");
+        append_text("  save <local|remote> <H> <P> <U> [P] - Save Profile\n");
         append_text(
             "  save wg <priv> <pub> <end:port> <ip> - Save WireGuard\n");
         append_text("  home - Return to Launcher\n");
         append_text("  exit - Disconnect SSH\n");
+        append_text("  cancel - Abort a connection attempt\n");
+        append_text("  ~1..~3 / ~n - Switch session slot / next\n");
+        append_text("  ~h / ~. - Detach to launcher / close session\n");
+        append_text("  resume [on|off] - tmux/screen shell, auto-reconnect\n");
+        append_text("  forget - Clear cached host keys\n");
+        append_text("  keygen / importkey - New Ed25519 key / from FFat\n");
+        append_text("  pubkey - Show the key for authorized_keys\n");
         append_text("  clear - Clear terminal\n");
+        append_text("  Long press: scroll output history, type to search\n");
+        append_text("  stats - Buffer, latency, haptic and power counters\n");
       } else if (!current_input.empty()) {
         append_text("Unknown command. Type 'help'\n");
       }
 
       // Save to history
       if (!current_input.empty()) {
+        load_persistent();
         auto it = std::find(command_history.begin(), command_history.end(),
                             current_input);
         if (it != command_history.end()) {
           command_history.erase(it);
         }
         command_history.push_back(current_input);
-        history_needs_save = true;
+        log_history(LOG_HIST_ADD, current_input);
       }
     }
 
-    current_input.clear();
-    cursor_pos = 0;
+    input_line.clear();
     history_index = -1;
   } else if (key == 8 || key == 127) {
-    // Backspace
-    if (cursor_pos > 0 && !current_input.empty()) {
-      current_input.erase(cursor_pos - 1, 1);
-      cursor_pos--;
-    }
+    input_line.backspace();
   } else if (key >= 32 && key <= 126) {
-    // Printable character
-    current_input.insert(cursor_pos, 1, key);
-    cursor_pos++;
+    input_line.insert(key);
   }
 
   update_input_display();
 }
 
 void SSHTerminal::flush_display_buffer() {
-  if (text_buffer.empty())
-    return;
-
-  append_text(text_buffer.c_str());
-  text_buffer.clear();
-
-  if (bytes_received > 0 && byte_counter_label) {
-    char *counter_buf = (char *)malloc(32);
-    if (counter_buf) {
-      if (bytes_received < 1024) {
-        snprintf(counter_buf, 32, "%zu B", bytes_received);
-      } else if (bytes_received < 1024 * 1024) {
-        snprintf(counter_buf, 32, "%.1f KB", bytes_received / 1024.0);
-      } else {
-        snprintf(counter_buf, 32, "%.2f MB",
-                 bytes_received / (1024.0 * 1024.0));
-      }
-      lv_async_call(async_update_counter_cb, counter_buf);
+  for (int i = 0; i < SSH_MAX_SESSIONS; i++) {
+    if (sessions[i].rx_ring.available()) {
+      ui_mailbox.mark(UI_DIRTY_RX);
+      break;
     }
   }
+  out_pacer.presented(esp_timer_get_time());
+}
 
-  last_display_update = esp_timer_get_time() / 1000;
+// esp_timer task: the frame deadline of bytes the pacer held back
+void SSHTerminal::out_tail_cb(void *arg) {
+  ((SSHTerminal *)arg)->flush_display_buffer();
 }
 
-void SSHTerminal::ssh_receive_task(void *param) {
-  SSHTerminal *terminal = (SSHTerminal *)param;
-  char buffer[4096];
+void SSHTerminal::drain_rx() {
+  // Every slot is parsed, shown or not, so a switch lands on a current
+  // screen. The one on screen goes first; the budget is shared.
+  size_t budget = UI_DRAIN_BUDGET;
+  bool more = false;
+  for (int k = 0; k < SSH_MAX_SESSIONS; k++) {
+    TermSession &s = sessions[(active + k) % SSH_MAX_SESSIONS];
+    if (!s.rx_ring.available())
+      continue;
+    const char *span;
+    size_t n;
+    while (budget > 0 && (n = s.rx_ring.read_span(&span)) > 0) {
+      if (n > budget)
+        n = budget;
+      s.vt.feed(span, n);
+      s.rx_ring.consume(n);
+      budget -= n;
+    }
+
+    // Index the new history lines; only they are tested against the query
+    if (s.search.update() && k == 0 && scroll_mode)
+      update_search_label();
+    if (s.rx_ring.available())
+      more = true;
+  }
 
-  while (terminal->run_receive_task && terminal->ssh_connected &&
-         terminal->channel) {
-    int nbytes = ssh_channel_read_nonblocking(terminal->channel, buffer,
-                                              sizeof(buffer) - 1, 0);
+  if (budget < UI_DRAIN_BUDGET)
+    out_pacer.note_frame(UI_DRAIN_BUDGET - budget, esp_timer_get_time());
 
-    if (nbytes > 0) {
-      buffer[nbytes] = '\0';
-      terminal->process_received_data(buffer, nbytes);
-    } else if (nbytes == SSH_ERROR ||
-               (terminal->channel && ssh_channel_is_eof(terminal->channel))) {
-      break;
+  if (scroll_mode)
+    scroll_history(0); // Offset moved to stay on the same lines
+  else
+    update_byte_counter();
+
+  // Over budget: pick the rest up next frame
+  if (more)
+    ui_mailbox.mark(UI_DIRTY_RX);
+}
+
+void SSHTerminal::update_byte_counter() {
+  uint32_t total = cur().bytes_received;
+  if (!byte_counter_label)
+    return;
+  if (total == 0) {
+    lv_label_set_text(byte_counter_label, "");
+  } else {
+    char counter[32];
+    ByteRing::Stats st = cur().rx_ring.stats();
+    int len;
+    if (total < 1024) {
+      len = snprintf(counter, sizeof(counter), "%u B", (unsigned)total);
+    } else if (total < 1024 * 1024) {
+      len = snprintf(counter, sizeof(counter), "%.1f KB", total / 1024.0);
+    } else {
+      len = snprintf(counter, sizeof(counter), "%.2f MB",
+                     total / (1024.0 * 1024.0));
     }
+    if (st.dropped && len > 0 && len < (int)sizeof(counter))
+      snprintf(counter + len, sizeof(counter) - len, " !%u",
+               (unsigned)st.dropped);
+    lv_label_set_text(byte_counter_label, counter);
+  }
+}
 
-    vTaskDelay(pdMS_TO_TICKS(10));
+// Read what one session has waiting into its ring. Receive task, with
+// rx_mutex held.
+int SSHTerminal::receive_session(TermSession &s, char *buf, size_t cap) {
+  int nbytes = 0;
+  size_t drained = 0;
+  size_t room;
+  while ((room = s.rx_ring.free_space()) > 0) {
+    // Backpressure: never read more than the ring can take, so TCP flow
+    // control throttles the host instead of us dropping output
+    size_t want = room < cap ? room : cap;
+    nbytes = ssh_channel_read_nonblocking(s.channel, buf, want, 0);
+    if (nbytes <= 0)
+      break;
+    process_received_data(s, buf, nbytes);
+    drained += nbytes;
+    if (drained >= RX_DRAIN_BUDGET)
+      break;
+  }
+  if (drained > 0)
+    s.last_io_ms = millis();
+
+  if (nbytes == SSH_ERROR || ssh_channel_is_eof(s.channel)) {
+    // The remote side ended the shell (EOF) or the link failed; the UI
+    // task tears the session down
+    s.link_lost = !ssh_channel_is_eof(s.channel);
+    s.ended = true;
+    flush_display_buffer();
+    ui_mailbox.mark(UI_DIRTY_SESSION);
+    return RX_ENDED;
   }
 
-  terminal->run_receive_task = false;
-  terminal->receive_task_handle = nullptr;
+  if (room == 0) {
+    // Ring full: wait for the UI to drain it
+    s.rx_ring.note_stall();
+    flush_display_buffer();
+    return RX_STALLED;
+  }
+  if (nbytes > 0)
+    return RX_BUSY;
+
+  // Sessions off screen send nothing; keep NAT and the server from timing
+  // the TCP connection out
+  bool shown = &s == &cur() && !in_launcher;
+  if (!shown && millis() - s.last_io_ms > SSH_KEEPALIVE_MS) {
+    ssh_send_ignore(s.session, "");
+    s.last_io_ms = millis();
+  }
+  return RX_IDLE;
 }
 
-std::string SSHTerminal::apply_ansi_formatting(const char *data, size_t len) {
-  std::string result;
-  result.reserve(len * 1.5); // Space for LVGL tags
+// One task for every session: each pass drains all of them, then sleeps in
+// a single select() on their sockets. Exits with the last session.
+void SSHTerminal::ssh_receive_task(void *param) {
+  SSHTerminal *terminal = (SSHTerminal *)param;
+  char buffer[4096];
 
-  for (size_t i = 0; i < len; i++) {
-    if (data[i] == '\x1B' || data[i] == '\033') {
-      i++;
-      if (i >= len)
-        break;
+  for (;;) {
+    fd_set rfds;
+    FD_ZERO(&rfds);
+    socket_t max_fd = -1;
+    bool busy = false;
+    bool stalled = false;
+    int live = 0;
+
+    xSemaphoreTake(terminal->rx_mutex, portMAX_DELAY);
+    ClosedHandles closed[SSH_MAX_SESSIONS];
+    uint8_t nclosed = terminal->closed_count;
+    memcpy(closed, terminal->closed, nclosed * sizeof(closed[0]));
+    terminal->closed_count = 0;
+    for (int i = 0; i < SSH_MAX_SESSIONS; i++) {
+      TermSession &s = terminal->sessions[i];
+      if (!s.connected || s.ended)
+        continue;
+      int rc = terminal->receive_session(s, buffer, sizeof(buffer));
+      if (rc == RX_ENDED)
+        continue;
+      live++;
+      busy |= rc == RX_BUSY;
+      stalled |= rc == RX_STALLED;
+      if (rc == RX_IDLE) {
+        socket_t fd = ssh_get_fd(s.session);
+        FD_SET(fd, &rfds);
+        if (fd > max_fd)
+          max_fd = fd;
+      }
+    }
+    if (!live) {
+      // The next on_shell_ready or close_session starts a new task
+      terminal->receive_task_handle = nullptr;
+      xSemaphoreGive(terminal->rx_mutex);
+      for (uint8_t i = 0; i < nclosed; i++)
+        free_handles(closed[i].session, closed[i].channel);
+      break;
+    }
+    xSemaphoreGive(terminal->rx_mutex);
 
-      if (data[i] == '[') {
-        i++;
-        std::string params;
-        while (i < len && !((data[i] >= 'A' && data[i] <= 'Z') ||
-                            (data[i] >= 'a' && data[i] <= 'z'))) {
-          params += data[i];
-          i++;
-        }
+    // Closed slots, outside the mutex: no one else has these handles
+    for (uint8_t i = 0; i < nclosed; i++)
+      free_handles(closed[i].session, closed[i].channel);
 
-        char cmd = data[i];
-        if (cmd == 'm') { // SGR - Select Graphic Rendition (Colors)
-          if (params == "0" || params.empty()) {
-            result += "#"; // Reset color tag for LVGL
-          } else if (params == "31") {
-            result += "#FF3333 "; // Red
-          } else if (params == "32") {
-            result += "#00FF66 "; // Green
-          } else if (params == "33") {
-            result += "#FFFF00 "; // Yellow
-          } else if (params == "34") {
-            result += "#3366FF "; // Blue
-          } else if (params == "35") {
-            result += "#FF33FF "; // Magenta
-          } else if (params == "36") {
-            result += "#33FFFF "; // Cyan
-          }
-        }
-      } else if (data[i] == ']') {
-        // OSC codes - skip
-        while (i < len && data[i] != '\007')
-          i++;
-      }
-    } else if (data[i] == '\r') {
+    if (busy) {
+      // Bulk output: let other tasks run, then keep draining
+      taskYIELD();
       continue;
-    } else {
-      // Escape special LVGL characters if they appear in raw data
-      if (data[i] == '#')
-        result += "##";
-      else
-        result += data[i];
     }
+
+    // Sleep until a socket is readable; a full ring is polled instead. A
+    // socket closed meanwhile fails the select and is gone next pass.
+    if (max_fd < 0) {
+      vTaskDelay(pdMS_TO_TICKS(RX_STALL_POLL_MS));
+      continue;
+    }
+    struct timeval tv;
+    tv.tv_sec = 0;
+    tv.tv_usec = (stalled ? RX_STALL_POLL_MS : RX_IDLE_TIMEOUT_MS) * 1000;
+    select(max_fd + 1, &rfds, NULL, NULL, &tv);
   }
 
-  return result;
+  vTaskDelete(NULL);
 }
 
-void SSHTerminal::process_received_data(const char *data, size_t len) {
-  bytes_received += len;
+void SSHTerminal::vt_reply_cb(const char *data, size_t len, void *ctx) {
+  // Terminal reports (DA, cursor position) go straight back to the host
+  TermSession *s = (TermSession *)ctx;
+  if (s && ssht_instance)
+    ssht_instance->write_session(*s, data, len);
+}
 
-  std::string cleaned = apply_ansi_formatting(data, len);
-  text_buffer += cleaned;
+void SSHTerminal::process_received_data(TermSession &s, const char *data,
+                                        size_t len) {
+  s.bytes_received += len;
 
-  int64_t current_time = esp_timer_get_time() / 1000;
+  // Raw bytes: VTParser keeps its state across chunks on the UI side.
+  // Anything that does not fit is counted in the ring's drop statistics.
+  s.rx_ring.write(data, len);
 
-  if (text_buffer.size() > 2048) {
-    text_buffer = text_buffer.substr(text_buffer.size() - 1024);
+  int64_t now = esp_timer_get_time();
+  if (out_pacer.on_data(len, now)) {
+    esp_timer_stop(out_tail_timer);
+    flush_display_buffer();
+  } else {
+    // Already armed for an earlier chunk: that deadline stands
+    esp_timer_start_once(out_tail_timer, out_pacer.tail_wait_us(now));
   }
+}
 
-  if (current_time - last_display_update >= 100) {
-    flush_display_buffer();
+void SSHTerminal::load_persistent() {
+  if (persist_loaded)
+    return;
+  // A boot job may be loading right now; wait for it instead of racing
+  xSemaphoreTake(persist_mutex, portMAX_DELAY);
+  if (!persist_loaded) {
+    replay_persistent();
+    persist_loaded = true;
   }
+  xSemaphoreGive(persist_mutex);
 }
 
-void SSHTerminal::load_history() {
-  preferences.begin("ssh_term", true);
-  String history_str = preferences.getString("history", "");
-  preferences.end();
+void SSHTerminal::replay_persistent() {
+  if (!FFat.begin(true) || !session_log.begin(FFat, PERSIST_LOG_PATH)) {
+    Serial.println("[PERSIST] FFat unavailable, history kept in RAM only");
+    return;
+  }
 
-  if (history_str.length() > 0) {
-    size_t pos = 0;
-    std::string hist = history_str.c_str();
-    while ((pos = hist.find('\n')) != std::string::npos) {
-      std::string cmd = hist.substr(0, pos);
-      if (!cmd.empty()) {
+  if (session_log.exists()) {
+    session_log.replay(persist_replay_cb, this);
+  } else {
+    // One-time import of the old NVS blobs
+    prefs_lock();
+    preferences.begin("ssh_term", false);
+    String hist = preferences.getString("history", "");
+    String session = preferences.getString("session", "");
+    int start = 0;
+    while (start < (int)hist.length()) {
+      int nl = hist.indexOf('\n', start);
+      if (nl < 0)
+        nl = hist.length();
+      if (nl > start) {
+        std::string cmd(hist.c_str() + start, nl - start);
         command_history.push_back(cmd);
+        session_log.append(LOG_HIST_ADD, cmd.data(), cmd.size());
       }
-      hist.erase(0, pos + 1);
+      start = nl + 1;
+    }
+    if (session.length() > 0) {
+      restored_session = session.c_str();
+      session_log.append(LOG_SESSION, session.c_str(), session.length());
     }
-    if (!hist.empty()) {
-      command_history.push_back(hist);
+    if (session_log.flush()) {
+      preferences.remove("history");
+      preferences.remove("session");
     }
+    preferences.end();
+    prefs_unlock();
+  }
+
+  if (session_log.needs_compaction())
+    session_log.compact(persist_emit_cb, this);
+}
+
+void SSHTerminal::persist_replay_cb(uint8_t type, const char *data,
+                                    size_t len, void *ctx) {
+  SSHTerminal *t = (SSHTerminal *)ctx;
+  std::vector<std::string> &hist = t->command_history;
+  switch (type) {
+  case LOG_HIST_ADD:
+  case LOG_HIST_DEL: {
+    std::string cmd(data, len);
+    auto it = std::find(hist.begin(), hist.end(), cmd);
+    if (it != hist.end())
+      hist.erase(it);
+    if (type == LOG_HIST_ADD)
+      hist.push_back(cmd);
+    break;
+  }
+  case LOG_SESSION:
+    t->restored_session.assign(data, len);
+    break;
+  default:
+    break; // Unknown record from a newer build
+  }
+}
+
+// Live state for compaction: the history, then one fresh snapshot
+void SSHTerminal::persist_emit_cb(LogStore &log, void *ctx) {
+  SSHTerminal *t = (SSHTerminal *)ctx;
+  for (const auto &cmd : t->command_history)
+    log.append(LOG_HIST_ADD, cmd.data(), cmd.size());
+  if (!t->restored_session.empty())
+    log.append(LOG_SESSION, t->restored_session.data(),
+               t->restored_session.size()); // Not shown yet
+  else if (t->terminal_screen && t->persist_loaded)
+    t->append_session_snapshot(log);
+}
+
+void SSHTerminal::log_history(uint8_t type, const std::string &cmd) {
+  if (session_log.ready())
+    session_log.append(type, cmd.data(), cmd.size());
+}
+
+void SSHTerminal::persist_tick(uint32_t now_ms) {
+  if (!persist_loaded || !session_log.ready() ||
+      now_ms - last_persist_ms < PERSIST_FLUSH_MS)
+    return;
+  last_persist_ms = now_ms;
+
+  // Snapshot the screen only when new output arrived since the last one
+  if (terminal_screen && cur().bytes_received != snapshot_rx_bytes &&
+      now_ms - last_snapshot_ms >= PERSIST_SNAPSHOT_MS) {
+    last_snapshot_ms = now_ms;
+    snapshot_rx_bytes = cur().bytes_received;
+    append_session_snapshot(session_log);
   }
+
+  session_log.flush();
+  if (session_log.needs_compaction())
+    session_log.compact(persist_emit_cb, this);
+}
+
+bool SSHTerminal::can_light_sleep() const {
+  // Manual light sleep does not keep a WiFi association alive
+  ConnStageState wifi = conn.state(CONN_WIFI);
+  return !is_connecting && !conn.busy() && sessions_open() == 0 &&
+         wifi != STAGE_RUNNING && wifi != STAGE_BACKOFF &&
+         !WiFi.isConnected() && !ui_mailbox.pending();
 }
 
 void SSHTerminal::navigate_history(int direction) {
+  load_persistent();
   if (command_history.empty())
     return;
 
@@ -1221,8 +1693,7 @@ void SSHTerminal::navigate_history(int direction) {
       history_index--;
     } else if (history_index == 0) {
       history_index = -1;
-      current_input.clear();
-      cursor_pos = 0;
+      input_line.clear();
       update_input_display();
       return;
     }
@@ -1230,17 +1701,102 @@ void SSHTerminal::navigate_history(int direction) {
 
   if (history_index >= 0 && history_index < (int)command_history.size()) {
     int idx = command_history.size() - 1 - history_index;
-    current_input = command_history[idx];
-    cursor_pos = current_input.length();
+    input_line.set(command_history[idx].c_str());
+    update_input_display();
+  }
+}
+
+void SSHTerminal::set_scroll_mode(bool on) {
+  if (on == scroll_mode)
+    return;
+  scroll_mode = on;
+  if (on) {
+    scroll_history(0);
+    update_search_label();
+  } else {
+    search_line.clear();
+    cur().search.set_query("");
+    search_current = UINT32_MAX;
+    term_view.set_highlight(nullptr, 0, UINT32_MAX);
+    term_view.scroll_to_bottom();
+    update_byte_counter();
     update_input_display();
   }
 }
 
+void SSHTerminal::apply_search() {
+  ScrollbackSearch &search = cur().search;
+  search.set_query(search_line.c_str());
+  uint32_t n = search.match_count();
+  select_match(n ? search.match_id(n - 1) : UINT32_MAX); // Newest first
+}
+
+void SSHTerminal::select_match(uint32_t id) {
+  ScrollbackSearch &search = cur().search;
+  search_current = id;
+  term_view.set_highlight(search.query(), strlen(search.query()), id);
+  if (id != UINT32_MAX)
+    term_view.scroll_to_line(id);
+  scroll_history(0);
+  update_search_label();
+}
+
+void SSHTerminal::search_step(int direction) {
+  ScrollbackSearch &search = cur().search;
+  uint32_t n = search.match_count();
+  if (!scroll_mode || !n)
+    return;
+  // Matches are kept by line id, so locate the current one again
+  uint32_t pos = n - 1;
+  for (uint32_t i = 0; i < n; i++) {
+    if (search.match_id(i) >= search_current) {
+      pos = i;
+      break;
+    }
+  }
+  int64_t next = (int64_t)pos - direction;
+  if (next < 0)
+    next = 0;
+  if (next >= n)
+    next = n - 1;
+  select_match(search.match_id(next));
+}
+
+void SSHTerminal::update_search_label() {
+  ScrollbackSearch &search = cur().search;
+  char buf[UI_INPUT_LEN];
+  if (search_line.empty()) {
+    snprintf(buf, sizeof(buf), "/ type to search, Enter to exit");
+  } else {
+    uint32_t n = search.match_count();
+    uint32_t pos = 0;
+    for (uint32_t i = 0; i < n; i++)
+      if (search.match_id(i) == search_current)
+        pos = i + 1;
+    snprintf(buf, sizeof(buf), "/%s  [%u/%u]", search_line.c_str(),
+             (unsigned)pos, (unsigned)n);
+  }
+  ui_mailbox.set_input(buf);
+}
+
+void SSHTerminal::scroll_history(int lines) {
+  if (!scroll_mode)
+    return;
+  term_view.scroll_by(lines);
+  if (byte_counter_label) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "SCROLL -%u/%u",
+             (unsigned)term_view.scroll_offset(),
+             (unsigned)cur().scrollback.count());
+    lv_label_set_text(byte_counter_label, buf);
+  }
+}
+
 void SSHTerminal::delete_current_history_entry() {
   if (history_index >= 0 && history_index < (int)command_history.size()) {
     int idx = command_history.size() - 1 - history_index;
+    log_history(LOG_HIST_DEL, command_history[idx]);
     command_history.erase(command_history.begin() + idx);
-    history_needs_save = true;
 
     if (history_index >= (int)command_history.size()) {
       history_index = command_history.size() - 1;
@@ -1248,11 +1804,9 @@ void SSHTerminal::delete_current_history_entry() {
 
     if (history_index >= 0) {
       int new_idx = command_history.size() - 1 - history_index;
-      current_input = command_history[new_idx];
-      cursor_pos = current_input.length();
+      input_line.set(command_history[new_idx].c_str());
     } else {
-      current_input.clear();
-      cursor_pos = 0;
+      input_line.clear();
     }
 
     update_input_display();
@@ -1261,20 +1815,8 @@ void SSHTerminal::delete_current_history_entry() {
 }
 
 void SSHTerminal::save_history() {
-  if (!history_needs_save)
-    return;
-
-  preferences.begin("ssh_term", false);
-  std::string hist;
-  for (const auto &cmd : command_history) {
-    if (!hist.empty())
-      hist += '\n';
-    hist += cmd;
-  }
-  preferences.putString("history", hist.c_str());
-  preferences.end();
-
-  history_needs_save = false;
+  if (session_log.ready())
+    session_log.flush();
 }
 
 void SSHTerminal::btn_pulse_anim_cb(void *var, int32_t v) {
@@ -1288,9 +1830,11 @@ void SSHTerminal::btn_pulse_anim_cb(void *var, int32_t v) {
 void SSHTerminal::glitch_anim_cb(void *var, int32_t v) {
   lv_obj_t *obj = (lv_obj_t *)var;
   if (v == 0) {
-    lv_obj_set_style_translate_x(obj, 0, 0);
-    lv_obj_set_style_transform_scale(obj, 256, 0);
-    lv_obj_set_style_transform_angle(obj, 0, 0);
+    // Back to the object's own styles (a focused button is scaled up)
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_TRANSLATE_X, 0);
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_TRANSFORM_SCALE_X, 0);
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_TRANSFORM_SCALE_Y, 0);
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_TRANSFORM_ROTATION, 0);
   } else {
     lv_obj_set_style_translate_x(obj, (rand() % 20) - 10, 0); // CRT jitter
     lv_obj_set_style_transform_scale(obj, 256 + (v / 2), 0);
@@ -1305,35 +1849,40 @@ void SSHTerminal::trigger_glitch(lv_obj_t *obj) {
   lv_anim_set_exec_cb(&a, (lv_anim_exec_xcb_t)glitch_anim_cb);
   lv_anim_set_values(&a, 50, 0);
   lv_anim_set_time(&a, 150);
-  lv_anim_start(&a);
+  AnimScheduler::start(&a, false);
 }
 
 void SSHTerminal::title_flicker_cb(void *var, int32_t v) {
   lv_obj_t *obj = (lv_obj_t *)var;
-  if (v % 100 > 95) { // Rapid flicker occasional dropout
-    lv_obj_set_style_opa(obj, 0, 0);
-  } else if (v % 30 < 10) { // Slight dimming
-    lv_obj_set_style_opa(obj, 180, 0);
-  } else {
-    lv_obj_set_style_opa(obj, 255, 0);
-  }
+  lv_opa_t opa = LV_OPA_COVER;
+  if (v % 100 > 95) // Rapid flicker occasional dropout
+    opa = LV_OPA_TRANSP;
+  else if (v % 30 < 10) // Slight dimming
+    opa = 180;
+  // Setting a style invalidates even when the value is the same
+  if (lv_obj_get_style_opa(obj, 0) != opa)
+    lv_obj_set_style_opa(obj, opa, 0);
 }
 
-void SSHTerminal::save_session() {
-  if (cumulative_text.empty())
-    return;
-  preferences.begin("ssh_term", false);
-  preferences.putString("session", cumulative_text.c_str());
-  preferences.end();
+bool SSHTerminal::append_session_snapshot(LogStore &log) {
+  const TerminalGrid &screen = cur().vt.screen();
+  size_t max = (size_t)screen.cols() * screen.rows() * 3 + screen.rows() + 1;
+  char *snapshot = (char *)malloc(max);
+  if (!snapshot)
+    return false;
+  lvgl_lock();
+  size_t len = screen.snapshot_text(snapshot, max);
+  lvgl_unlock();
+  bool ok = len > 0 && log.append(LOG_SESSION, snapshot, len);
+  free(snapshot);
+  return ok;
 }
 
-void SSHTerminal::load_session() {
-  preferences.begin("ssh_term", true);
-  String session_str = preferences.getString("session", "");
-  preferences.end();
-  if (session_str.length() > 0) {
-    cumulative_text = session_str.c_str();
-  }
+void SSHTerminal::save_session() {
+  if (!session_log.ready() || !terminal_screen)
+    return;
+  append_session_snapshot(session_log);
+  session_log.flush();
 }
 
 void SSHTerminal::grid_scroll_anim_cb(void *var, int32_t v) {
@@ -1345,5 +1894,6 @@ void SSHTerminal::grid_scroll_anim_cb(void *var, int32_t v) {
     opa = 12 - (v - 280) / 4;
   if (opa < 0)
     opa = 0;
-  lv_obj_set_style_bg_opa(obj, opa, 0);
+  if (lv_obj_get_style_bg_opa(obj, 0) != opa)
+    lv_obj_set_style_bg_opa(obj, opa, 0);
 }
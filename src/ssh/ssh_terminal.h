@@ -7,13 +7,25 @@
 #ifndef SSH_TERMINAL_H
 #define SSH_TERMINAL_H
 
-#include "UIMessageQueue.h"
+#include "ByteRing.h"
+#include "ConnectionManager.h"
+#include "KeyStore.h"
+#include "LatencyHistogram.h"
+#include "LineEditor.h"
+#include "LogStore.h"
+#include "OutputPacer.h"
+#include "Scrollback.h"
+#include "ScrollbackSearch.h"
+#include "TerminalView.h"
+#include "UIMailbox.h"
+#include "VTParser.h"
 #include <Arduino.h>
 #include <LilyGoLib.h>
 #include <Preferences.h>
 #include <WiFi.h>
 #include <WireGuard-ESP32.h>
 #include <atomic>
+#include <esp_timer.h>
 #include <libssh/libssh.h>
 #include <lvgl.h>
 #include <string>
@@ -25,7 +37,7 @@ extern void lvgl_unlock();
 extern void i2c_lock();
 extern void i2c_unlock();
 
-// UIMessage from UIMessageQueue.h is used for pooled updates
+// UI updates from any task go through UIMailbox (see service_ui)
 
 struct SSHProfile {
   std::string host;
@@ -35,6 +47,26 @@ struct SSHProfile {
   bool active;
 };
 
+#define SSH_MAX_SESSIONS 3
+#define SESSION_SCROLLBACK_LINES 1500 // Slots after the first, ~600 KB each
+
+// One shell: connection, screen, output history and receive ring. All
+// slots are read by a single receive task; the LVGL task shows one.
+struct TermSession {
+  ssh_session session = nullptr;
+  ssh_channel channel = nullptr;
+  ConnTarget target = {};
+  std::atomic<bool> connected = {false};
+  std::atomic<bool> ended = {false};     // Shell gone, UI task tears down
+  std::atomic<bool> link_lost = {false}; // Ended without an EOF
+  VTParser vt;                           // Owns the screen model
+  Scrollback scrollback;                 // Lines scrolled off, in PSRAM
+  ScrollbackSearch search;
+  ByteRing rx_ring; // ssh_rx task -> LVGL task, raw PTY bytes
+  std::atomic<uint32_t> bytes_received = {0};
+  uint32_t last_io_ms = 0; // Receive task: keepalive timer
+};
+
 struct WireGuardConfig {
   std::string private_key;
   std::string remote_public_key;
@@ -56,22 +88,37 @@ public:
   void show_terminal();
 
   // WireGuard management
-  bool wg_connect();
   void wg_disconnect();
-  void save_wg_config(const char *private_key, const char *public_key,
+  bool save_wg_config(const char *private_key, const char *public_key,
                       const char *endpoint, const char *local_ip);
   bool load_wg_config(WireGuardConfig &config);
 
-  // WiFi management
-  bool wifi_connect(const char *ssid, const char *password);
-  bool wifi_auto_connect();
+  // WiFi management. Requests are carried out by the connection manager
+  // in the background; progress is reported in the terminal.
+  void wifi_connect(const char *ssid, const char *password);
+  void wifi_auto_connect();
   void wifi_disconnect();
   bool is_wifi_connected() const { return wifi_connected; }
 
-  // SSH connection
+  // SSH connection. connect() only starts the attempt; false if one is
+  // already in flight.
   bool connect(const char *host, int port, const char *user, const char *pass);
-  void disconnect();
-  bool is_ssh_connected() const { return ssh_connected; }
+  void cancel_connect();
+  void disconnect(); // Closes the session on screen
+  bool is_ssh_connected() const { return sessions[active].connected; }
+
+  // Up to SSH_MAX_SESSIONS shells stay open side by side, each with its own
+  // screen and history. "~1".."~3" and "~n" at the start of the input line
+  // switch between them; picking a profile that is already open shows it.
+  void switch_session(int slot); // Any task; applied by service_ui
+  int sessions_open() const;
+
+  // Fast reconnect. "~h" detaches to the launcher with the sessions kept
+  // open. With resume on, shells run under tmux/screen and a dropped link
+  // reconnects.
+  void detach();
+  bool resume_enabled();
+  void set_resume(bool on);
 
   // Terminal I/O
   void send_command(const char *cmd);
@@ -81,7 +128,7 @@ public:
   void clear_terminal();
 
   // Profile Management
-  void save_profile(const char *type, const char *host, int port,
+  bool save_profile(const char *type, const char *host, int port,
                     const char *user, const char *pass);
   bool load_profile(const char *type, SSHProfile &profile);
   void connect_to_profile(const char *type);
@@ -89,55 +136,113 @@ public:
   // History & Navigation
   void navigate_history(int direction);
   void delete_current_history_entry();
+  bool is_browsing_history() const { return history_index >= 0; }
+
+  // Boot jobs, safe to run on another task: replay the history/session log
+  // and warm the profile cache. Both also run on first use if needed.
+  void load_persistent();
+  void preload_profiles();
+
+  // Flush batched history/session records and compact the log when due.
+  // Call from loop() without the LVGL lock held.
+  void persist_tick(uint32_t now_ms);
+
+  // Nothing in flight that a light sleep would break: no connect, session
+  // or WiFi association, and no UI work pending
+  bool can_light_sleep() const;
+
+  // Scrollback view (encoder scrolls output instead of command history).
+  // Call with LVGL locked.
+  void set_scroll_mode(bool on);
+  bool in_scroll_mode() const { return scroll_mode; }
+  void scroll_history(int lines); // Positive = older output
+
+  // Incremental search while in scroll mode: typed keys edit the query,
+  // the encoder jumps between matches (positive = older)
+  bool search_active() const { return sessions[active].search.active(); }
+  void search_step(int direction);
 
   // Display updates
   void update_status_bar();
   void update_input_display();
   void flush_display_buffer();
+  // Apply everything posted since the last frame. Call once per
+  // lv_timer_handler pass from the LVGL task.
+  void service_ui();
+  ByteRing::Stats get_rx_stats() const {
+    return sessions[active].rx_ring.stats();
+  }
+  UIMessageQueue::Stats get_ui_queue_stats() const {
+    return ui_mailbox.pool_stats();
+  }
+  const LatencyHistogram &get_key_latency() const { return key_latency; }
 
   // Hardware feedback
   void vibrate(uint32_t ms = 50);
 
   // Tasks
   static void ssh_receive_task(void *param);
-  static void connection_task(void *param);
 
   // External access for main.cpp
   lv_group_t *get_launcher_group() { return launcher_group; }
   bool is_in_launcher() const { return in_launcher; }
 
 private:
-  // SSH session
-  ssh_session session = nullptr;
-  ssh_channel channel = nullptr;
+  friend class ConnectionManager;
+
+  // SSH sessions; the receive task holds rx_mutex while it reads them
+  TermSession sessions[SSH_MAX_SESSIONS];
+  uint8_t active = 0;          // Slot on screen (LVGL task)
+  int8_t connecting_slot = -1; // Slot the in-flight request will fill
+  SemaphoreHandle_t rx_mutex = nullptr;
+  // Handles of closed slots, freed by the receive task (rx_mutex)
+  struct ClosedHandles {
+    ssh_session session;
+    ssh_channel channel;
+  } closed[SSH_MAX_SESSIONS];
+  uint8_t closed_count = 0;
+  bool resume_shell = true;
+  bool resume_cached = false;
 
   // State
   bool wifi_connected = false;
-  bool ssh_connected = false;
   bool in_launcher = true;
   std::atomic<bool> is_connecting = {false};
-  std::atomic<bool> run_receive_task = {false};
 
   // Input handling
-  std::string current_input;
-  size_t cursor_pos = 0;
+  LineEditor input_line;
   bool cursor_visible = true;
+  int64_t key_stamp_us = 0;       // Last keypress, until the label is set
+  int64_t key_paint_stamp_us = 0; // Waiting for the next display refresh
+  LatencyHistogram key_latency;   // Keypress to flushed pixels
 
   // Command history
   std::vector<std::string> command_history;
   int history_index = -1;
-  bool history_needs_save = false;
+
+  // History and session snapshots, persisted as an append-only log
+  LogStore session_log;
+  std::atomic<bool> persist_loaded = {false}; // Log replayed
+  SemaphoreHandle_t persist_mutex = nullptr;
+  uint32_t last_persist_ms = 0;   // Last batch flush
+  uint32_t last_snapshot_ms = 0;  // Last session snapshot record
+  uint32_t snapshot_rx_bytes = 0; // bytes_received at that snapshot
 
   // Display buffer
-  std::string cumulative_text;
-  std::string text_buffer;
-  size_t bytes_received = 0;
-  int64_t last_display_update = 0;
+  TerminalView term_view; // Shows sessions[active]
+  uint16_t term_cols = 80; // PTY size requested in connect()
+  uint16_t term_rows = 24;
+  std::string restored_session;
+  bool scroll_mode = false;
+  LineEditor search_line;
+  uint32_t search_current = UINT32_MAX; // Line id of the selected match
+  OutputPacer out_pacer; // When PTY bytes are handed to the LVGL task
+  esp_timer_handle_t out_tail_timer = nullptr; // Presents a held-back tail
 
   // LVGL objects
   lv_obj_t *terminal_screen = nullptr;
   lv_obj_t *launcher_screen = nullptr;
-  lv_obj_t *output_label = nullptr;
+  lv_obj_t *output_view = nullptr;
   lv_obj_t *input_label = nullptr;
   lv_obj_t *status_bar = nullptr;
   lv_obj_t *byte_counter_label = nullptr;
@@ -147,33 +252,62 @@ private:
 
   // Task handles
   TaskHandle_t receive_task_handle = nullptr;
-  TaskHandle_t connection_task_handle = nullptr;
+  ConnectionManager conn;
+  KeyStore keys; // Public-key identity, parsed once at boot
   WireGuard wg;
-  UIMessageQueue ui_queue;
+
+  // NVS-backed launcher profiles and tunnel config, read once
+  SSHProfile profile_cache[2]; // local, remote
+  bool profile_cached[2] = {false, false};
+  WireGuardConfig wg_cache;
+  bool wg_cached = false;
+  UIMailbox ui_mailbox;
+  TaskHandle_t ui_task_handle = nullptr; // Task running lv_timer_handler
 
   static SSHTerminal *ssht_instance;
   // Helper methods
-  std::string apply_ansi_formatting(const char *data, size_t len);
-  void process_received_data(const char *data, size_t len);
-  void load_history();
+  TermSession &cur() { return sessions[active]; }
+  void process_received_data(TermSession &s, const char *data, size_t len);
+  static void out_tail_cb(void *arg);
+  int receive_session(TermSession &s, char *buf, size_t cap);
+  bool prepare_slot(int slot);
+  void prepare_pty(); // Grid of the connecting slot to the PTY size
+  int find_session(const ConnTarget &target) const;
+  bool open_session(const ConnTarget &target);
+  void close_session(int slot);
+  void write_session(TermSession &s, const char *data, size_t len);
+  bool start_receive_task();
+  static void free_handles(ssh_session session, ssh_channel channel);
+  void apply_switch(int slot);
+  void on_shell_ready(ssh_session new_session, ssh_channel new_channel,
+                      const ConnTarget &target);
+  void on_session_ended();
+  void show_public_key();
+  static void vt_reply_cb(const char *data, size_t len, void *ctx);
+  void replay_persistent();
+  void log_history(uint8_t type, const std::string &cmd);
   void save_history();
+  static void persist_replay_cb(uint8_t type, const char *data, size_t len,
+                                void *ctx);
+  static void persist_emit_cb(LogStore &log, void *ctx);
   static void launcher_event_cb(lv_event_t *e);
   static void btn_pulse_anim_cb(void *var, int32_t v);
   static void glitch_anim_cb(void *var, int32_t v);
   static void grid_scroll_anim_cb(void *var, int32_t v);
   static void title_flicker_cb(void *var, int32_t v);
 
-  // Async UI handlers
-  static void async_append_text_cb(void *param);
-  static void async_update_status_cb(void *param);
-  static void async_show_terminal_cb(void *param);
-  static void async_show_launcher_cb(void *param);
-  static void async_update_input_cb(void *param);
-  static void async_update_counter_cb(void *param);
+  // UI mailbox consumers (LVGL task)
+  static void mailbox_text_sink(const char *text, size_t len, void *ctx);
+  static void display_refr_ready_cb(lv_event_t *e);
+  void drain_rx();
+  void update_byte_counter();
+  void apply_search();
+  void select_match(uint32_t id);
+  void update_search_label();
   void trigger_glitch(lv_obj_t *obj);
 
+  bool append_session_snapshot(LogStore &log);
   void save_session();
-  void load_session();
 };
 
 #endif // SSH_TERMINAL_H
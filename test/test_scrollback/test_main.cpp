@@ -0,0 +1,210 @@
+/**
+ * Scrollback ring and ScrollbackSearch over it
+ *   pio test -e native -f test_scrollback
+ */
+
+#include "ssh/Scrollback.h"
+#include "ssh/ScrollbackSearch.h"
+#include "ssh/VTParser.h"
+#include <string.h>
+#include <string>
+#include <vector>
+#include <unity.h>
+
+static Scrollback *sb;
+static ScrollbackSearch *search;
+static VTParser *vt;
+
+static void feed(const char *s) { vt->feed(s, strlen(s)); }
+
+static void feed_lines(int from, int to) {
+  for (int i = from; i < to; i++) {
+    char line[32];
+    snprintf(line, sizeof(line), "line %d\r\n", i);
+    feed(line);
+  }
+}
+
+static std::string line_text(uint32_t i) {
+  uint16_t len;
+  const TermCell *cells = sb->line(i, &len);
+  std::string out;
+  for (uint16_t c = 0; c < len; c++)
+    out += (char)cells[c].glyph;
+  return out;
+}
+
+void setUp() {
+  sb = new Scrollback();
+  TEST_ASSERT_TRUE(sb->begin(40, 8));
+  search = new ScrollbackSearch();
+  TEST_ASSERT_TRUE(search->begin(sb));
+  vt = new VTParser();
+  vt->screen().resize(40, 4);
+  vt->screen().set_scrollback(sb);
+}
+
+void tearDown() {
+  delete vt;
+  delete search;
+  delete sb;
+}
+
+static void test_rows_scrolled_off_are_kept() {
+  feed_lines(0, 6);
+  // Four rows on screen, the cursor on the last: three lines left it
+  TEST_ASSERT_EQUAL_UINT32(3, sb->count());
+  TEST_ASSERT_EQUAL_STRING("line 0", line_text(0).c_str());
+  TEST_ASSERT_EQUAL_STRING("line 2", line_text(2).c_str());
+}
+
+static void test_trailing_blanks_are_trimmed() {
+  feed("\x1b[44mblue \x1b[0mplain   \r\n");
+  feed_lines(0, 3);
+  uint16_t len;
+  sb->line(0, &len);
+  TEST_ASSERT_EQUAL_UINT16(10, len);
+}
+
+static void test_oldest_lines_are_evicted() {
+  feed_lines(0, 23);
+  TEST_ASSERT_EQUAL_UINT32(8, sb->count());
+  TEST_ASSERT_EQUAL_UINT32(20, sb->total());
+  TEST_ASSERT_EQUAL_STRING("line 12", line_text(0).c_str());
+  TEST_ASSERT_EQUAL_STRING("line 19", line_text(7).c_str());
+}
+
+static void test_alt_screen_does_not_scroll_into_history() {
+  feed("\x1b[?1049h");
+  feed_lines(0, 10);
+  TEST_ASSERT_EQUAL_UINT32(0, sb->count());
+}
+
+static void test_deleted_lines_are_not_history() {
+  feed("a\r\nb\r\nc\r\n\x1b[H\x1b[2M");
+  TEST_ASSERT_EQUAL_UINT32(0, sb->count());
+  // SU scrolls the full screen: those lines are kept
+  feed("\x1b[2S");
+  TEST_ASSERT_EQUAL_UINT32(2, sb->count());
+  TEST_ASSERT_EQUAL_STRING("c", line_text(0).c_str());
+}
+
+static void test_search_finds_new_and_old_lines() {
+  feed("Error: disk\r\nok\r\nerror again\r\nok\r\nok\r\nok\r\n");
+  search->update();
+  search->set_query("ERROR");
+  TEST_ASSERT_EQUAL_UINT32(2, search->match_count());
+  TEST_ASSERT_EQUAL_UINT32(0, search->match_id(0));
+  TEST_ASSERT_EQUAL_UINT32(2, search->match_id(1));
+
+  // Streaming output is tested as it is indexed
+  feed("no match\r\nanother error\r\nok\r\nok\r\nok\r\n");
+  TEST_ASSERT_EQUAL_UINT32(1, search->update());
+  TEST_ASSERT_EQUAL_UINT32(3, search->match_count());
+}
+
+// dmesg-like history: timestamps, subsystems, hex and mixed words
+static void feed_log(int lines) {
+  static const char *const subsys[] = {"usb 1-1", "wlan0", "ext4-fs (sda1)",
+                                       "i2c i2c-0", "nvme0n1", "systemd[1]",
+                                       "audit", "eth0", "cpu3", "kernel"};
+  static const char *const words[] = {
+      "device",   "registered", "link",      "is",      "up",     "mounted",
+      "filesystem", "with",     "ordered",   "data",    "mode",   "new",
+      "high-speed", "address",  "using",     "driver",  "reset",  "timeout",
+      "failed",   "power",      "state",     "changed", "to",     "carrier",
+      "detected", "starting",   "service",   "finished", "queue", "irq",
+      "allocated", "buffer",    "config",    "firmware", "loaded", "version"};
+  uint32_t seed = 12345;
+  char line[96];
+  for (int i = 0; i < lines; i++) {
+    seed = seed * 1103515245u + 12345u;
+    int n = snprintf(line, sizeof(line), "[%5u.%06u] %s: ", i / 7,
+                     (unsigned)(seed >> 8) % 1000000, subsys[(seed >> 4) % 10]);
+    while (n < 60) {
+      seed = seed * 1103515245u + 12345u;
+      if ((seed >> 28) == 0)
+        n += snprintf(line + n, sizeof(line) - n, "0x%08x ", seed);
+      else
+        n += snprintf(line + n, sizeof(line) - n, "%s ",
+                      words[(seed >> 12) % 36]);
+    }
+    memcpy(line + n, "\r\n", 3);
+    feed(line);
+  }
+}
+
+static void use_history(uint32_t lines) {
+  tearDown();
+  sb = new Scrollback();
+  TEST_ASSERT_TRUE(sb->begin(80, lines));
+  search = new ScrollbackSearch();
+  TEST_ASSERT_TRUE(search->begin(sb));
+  vt = new VTParser();
+  vt->screen().resize(80, 4);
+  vt->screen().set_scrollback(sb);
+}
+
+static void test_sketch_skips_blocks_without_the_query() {
+  use_history(2000);
+  feed_log(2003);
+  TEST_ASSERT_EQUAL_UINT32(2000, sb->count());
+  search->update();
+
+  static const char *const misses[] = {"segfault", "ENOMEM", "xyzzy",
+                                       "oom-killer"};
+  for (int i = 0; i < 4; i++) {
+    search->set_query(misses[i]);
+    TEST_ASSERT_EQUAL_UINT32(0, search->match_count());
+    uint32_t blocks = search->blocks_scanned() + search->blocks_skipped();
+    TEST_ASSERT_TRUE(blocks >= 2000 / SEARCH_BLOCK_LINES);
+    // Almost every block is rejected by its sketch alone
+    TEST_ASSERT_TRUE_MESSAGE(search->blocks_skipped() * 10 >= blocks * 9,
+                             misses[i]);
+  }
+}
+
+static void test_longer_query_refines_matches() {
+  use_history(2000);
+  feed_log(2003);
+  search->update();
+  search->set_query("tim");
+  uint32_t broad = search->match_count();
+  search->set_query("timeout");
+  uint32_t narrow = search->match_count();
+  TEST_ASSERT_TRUE(narrow > 0 && narrow <= broad);
+
+  // Refined in place: same lines, same order as a fresh search
+  std::vector<uint32_t> refined;
+  for (uint32_t i = 0; i < narrow; i++)
+    refined.push_back(search->match_id(i));
+  search->set_query("");
+  search->set_query("timeout");
+  TEST_ASSERT_EQUAL_UINT32(narrow, search->match_count());
+  for (uint32_t i = 0; i < narrow; i++)
+    TEST_ASSERT_EQUAL_UINT32(refined[i], search->match_id(i));
+}
+
+static void test_find_within_a_line() {
+  feed("abc abc\r\n");
+  feed_lines(0, 3);
+  uint16_t len;
+  const TermCell *cells = sb->line(0, &len);
+  TEST_ASSERT_EQUAL_INT(0, ScrollbackSearch::find(cells, len, "abc", 3, 0));
+  TEST_ASSERT_EQUAL_INT(4, ScrollbackSearch::find(cells, len, "abc", 3, 1));
+  TEST_ASSERT_EQUAL_INT(-1, ScrollbackSearch::find(cells, len, "abc", 3, 5));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_rows_scrolled_off_are_kept);
+  RUN_TEST(test_trailing_blanks_are_trimmed);
+  RUN_TEST(test_oldest_lines_are_evicted);
+  RUN_TEST(test_alt_screen_does_not_scroll_into_history);
+  RUN_TEST(test_deleted_lines_are_not_history);
+  RUN_TEST(test_search_finds_new_and_old_lines);
+  RUN_TEST(test_sketch_skips_blocks_without_the_query);
+  RUN_TEST(test_longer_query_refines_matches);
+  RUN_TEST(test_find_within_a_line);
+  return UNITY_END();
+}
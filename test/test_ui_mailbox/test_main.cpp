@@ -0,0 +1,157 @@
+/**
+ * UIMessageQueue pool checkout/blocking and UIMailbox coalescing
+ *   pio test -e native -f test_ui_mailbox
+ */
+
+#include "ssh/UIMailbox.h"
+#include <string>
+#include <thread>
+#include <unity.h>
+
+static UIMessageQueue *pool;
+static UIMailbox *mailbox;
+
+void setUp() {
+  pool = new UIMessageQueue();
+  mailbox = new UIMailbox();
+}
+
+void tearDown() {
+  delete pool;
+  delete mailbox;
+}
+
+static void fill(UIMessage **out) {
+  for (int i = 0; i < UI_POOL_SIZE; i++) {
+    out[i] = pool->checkout();
+    TEST_ASSERT_NOT_NULL(out[i]);
+  }
+}
+
+static void test_checkout_exhausts_and_recovers() {
+  UIMessage *msgs[UI_POOL_SIZE];
+  fill(msgs);
+  TEST_ASSERT_NULL(pool->checkout());
+
+  UIMessageQueue::Stats s = pool->stats();
+  TEST_ASSERT_EQUAL_UINT32(UI_POOL_SIZE, s.in_use);
+  TEST_ASSERT_EQUAL_UINT32(UI_POOL_SIZE, s.high_water);
+  TEST_ASSERT_EQUAL_UINT32(1, s.exhaustions);
+  TEST_ASSERT_EQUAL_UINT32(1, s.drops);
+
+  pool->release(msgs[3]);
+  TEST_ASSERT_EQUAL_PTR(msgs[3], pool->checkout());
+}
+
+static void test_double_release_is_ignored() {
+  UIMessage *a = pool->checkout();
+  pool->release(a);
+  pool->release(a);
+  TEST_ASSERT_EQUAL_UINT32(0, pool->stats().in_use);
+}
+
+static void test_checkout_waits_for_release() {
+  UIMessage *msgs[UI_POOL_SIZE];
+  fill(msgs);
+  std::thread releaser([&msgs]() {
+    delay(20);
+    pool->release(msgs[0]);
+  });
+  uint32_t start = millis();
+  UIMessage *m = pool->checkout(1000);
+  uint32_t waited = millis() - start;
+  releaser.join();
+
+  TEST_ASSERT_EQUAL_PTR(msgs[0], m);
+  TEST_ASSERT_TRUE(waited >= 15 && waited < 1000);
+  TEST_ASSERT_EQUAL_UINT32(0, pool->stats().drops);
+}
+
+static void test_checkout_wait_times_out() {
+  UIMessage *msgs[UI_POOL_SIZE];
+  fill(msgs);
+  uint32_t start = millis();
+  TEST_ASSERT_NULL(pool->checkout(30));
+  TEST_ASSERT_TRUE(millis() - start >= 30);
+  TEST_ASSERT_EQUAL_UINT32(1, pool->stats().drops);
+}
+
+static std::string drained;
+static int sink_calls;
+
+static void sink(const char *text, size_t len, void *) {
+  drained.append(text, len);
+  sink_calls++;
+}
+
+static void drain() {
+  drained.clear();
+  sink_calls = 0;
+  mailbox->drain_text(sink, nullptr);
+}
+
+static void test_text_appends_coalesce() {
+  mailbox->post_text("one ", 0);
+  mailbox->post_text("two ", 0);
+  mailbox->post_text("three", 0);
+  TEST_ASSERT_EQUAL_UINT32(1, mailbox->pool_stats().in_use);
+
+  drain();
+  TEST_ASSERT_EQUAL_INT(1, sink_calls);
+  TEST_ASSERT_EQUAL_STRING("one two three", drained.c_str());
+  TEST_ASSERT_EQUAL_UINT32(0, mailbox->pool_stats().in_use);
+}
+
+static void test_long_text_spans_messages() {
+  std::string text(MAX_ASYNC_TEXT + 100, 'x');
+  TEST_ASSERT_TRUE(mailbox->post_text(text.c_str(), 0));
+  drain();
+  TEST_ASSERT_EQUAL_INT(2, sink_calls);
+  TEST_ASSERT_EQUAL_size_t(text.size(), drained.size());
+}
+
+static void test_full_pool_drops_text() {
+  std::string text((size_t)(MAX_ASYNC_TEXT - 1) * UI_POOL_SIZE + 1, 'y');
+  TEST_ASSERT_FALSE(mailbox->post_text(text.c_str(), 0));
+  drain();
+  TEST_ASSERT_EQUAL_INT(UI_POOL_SIZE, sink_calls);
+}
+
+static void test_latest_wins_and_dirty_bits() {
+  mailbox->take();
+  mailbox->set_status("first");
+  mailbox->set_status("second");
+  mailbox->request_screen(UI_SCREEN_TERMINAL);
+
+  TEST_ASSERT_TRUE(mailbox->pending());
+  uint32_t work = mailbox->take();
+  TEST_ASSERT_EQUAL_HEX32(UI_DIRTY_STATUS | UI_DIRTY_SCREEN, work);
+  TEST_ASSERT_FALSE(mailbox->pending());
+
+  char status[UI_STATUS_LEN];
+  mailbox->copy_status(status, sizeof(status));
+  TEST_ASSERT_EQUAL_STRING("second", status);
+  TEST_ASSERT_EQUAL(UI_SCREEN_TERMINAL, mailbox->requested_screen());
+}
+
+static void test_mark_notifies_consumer() {
+  mailbox->set_consumer(xTaskGetCurrentTaskHandle());
+  ulTaskNotifyTake(pdTRUE, 0);
+  mailbox->mark(UI_DIRTY_RX);
+  TEST_ASSERT_TRUE(ulTaskNotifyTake(pdTRUE, 0) > 0);
+  TEST_ASSERT_EQUAL_HEX32(UI_DIRTY_RX, mailbox->take());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_checkout_exhausts_and_recovers);
+  RUN_TEST(test_double_release_is_ignored);
+  RUN_TEST(test_checkout_waits_for_release);
+  RUN_TEST(test_checkout_wait_times_out);
+  RUN_TEST(test_text_appends_coalesce);
+  RUN_TEST(test_long_text_spans_messages);
+  RUN_TEST(test_full_pool_drops_text);
+  RUN_TEST(test_latest_wins_and_dirty_bits);
+  RUN_TEST(test_mark_notifies_consumer);
+  return UNITY_END();
+}
@@ -0,0 +1,179 @@
+/**
+ * VTParser escape handling and the TerminalGrid it drives
+ *   pio test -e native -f test_vtparser
+ */
+
+#include "ssh/VTParser.h"
+#include <string.h>
+#include <string>
+#include <unity.h>
+
+static VTParser *vt;
+static std::string replies;
+
+static void on_reply(const char *data, size_t len, void *) {
+  replies.append(data, len);
+}
+
+static void feed(const char *s) { vt->feed(s, strlen(s)); }
+
+// Row r as text, trailing blanks trimmed
+static std::string row_text(uint16_t r) {
+  const TerminalGrid &g = vt->screen();
+  const TermCell *cells = g.row(r);
+  std::string out;
+  for (uint16_t c = 0; c < g.cols(); c++)
+    out += (char)(cells[c].glyph < 0x80 ? cells[c].glyph : '?');
+  out.erase(out.find_last_not_of(' ') + 1);
+  return out;
+}
+
+void setUp() {
+  vt = new VTParser();
+  vt->screen().resize(80, 24);
+  vt->set_reply_handler(on_reply, nullptr);
+  replies.clear();
+}
+
+void tearDown() { delete vt; }
+
+static void test_text_and_line_discipline() {
+  feed("hello\r\nworld\nx");
+  TEST_ASSERT_EQUAL_STRING("hello", row_text(0).c_str());
+  TEST_ASSERT_EQUAL_STRING("world", row_text(1).c_str());
+  // Bare LF keeps the column unless the host sets LNM
+  TEST_ASSERT_EQUAL_STRING("     x", row_text(2).c_str());
+  feed("\x1b[20h\ny");
+  TEST_ASSERT_EQUAL_STRING("y", row_text(3).c_str());
+}
+
+static void test_cursor_positioning() {
+  feed("\x1b[5;10HA\x1b[2;3fB\x1b[5GC");
+  TEST_ASSERT_EQUAL_STRING("         A", row_text(4).c_str());
+  TEST_ASSERT_EQUAL_STRING("  B C", row_text(1).c_str());
+  TEST_ASSERT_EQUAL_UINT16(1, vt->screen().cursor_row());
+  TEST_ASSERT_EQUAL_UINT16(5, vt->screen().cursor_col());
+}
+
+static void test_sgr_colours() {
+  feed("\x1b[1;31mR\x1b[38;5;200mP\x1b[0mN");
+  const TermCell *cells = vt->screen().row(0);
+  TEST_ASSERT_EQUAL_UINT8(1, cells[0].fg);
+  TEST_ASSERT_TRUE(cells[0].flags & TERM_ATTR_BOLD);
+  TEST_ASSERT_EQUAL_UINT8(200, cells[1].fg);
+  TEST_ASSERT_TRUE(cells[2].flags & TERM_ATTR_DEFAULT_FG);
+  TEST_ASSERT_FALSE(cells[2].flags & TERM_ATTR_BOLD);
+}
+
+static void test_sequence_split_across_feeds() {
+  feed("\x1b[");
+  feed("3");
+  feed("1mA\xe2\x94");
+  feed("\x80");
+  const TermCell *cells = vt->screen().row(0);
+  TEST_ASSERT_EQUAL_UINT16('A', cells[0].glyph);
+  TEST_ASSERT_EQUAL_UINT8(1, cells[0].fg);
+  TEST_ASSERT_EQUAL_UINT16(0x2500, cells[1].glyph);
+}
+
+static void test_erase_in_line() {
+  feed("abcdef\x1b[1;3H\x1b[K");
+  TEST_ASSERT_EQUAL_STRING("ab", row_text(0).c_str());
+  feed("\x1b[1;2H\x1b[1K");
+  TEST_ASSERT_EQUAL_STRING("", row_text(0).c_str());
+}
+
+static void test_scroll_region() {
+  for (int i = 0; i < 23; i++) {
+    char line[8];
+    snprintf(line, sizeof(line), "%d\r\n", i);
+    feed(line);
+  }
+  // Rows 2..4 scroll; the rest stays put
+  feed("\x1b[3;5r\x1b[5;1H\n");
+  TEST_ASSERT_EQUAL_STRING("0", row_text(0).c_str());
+  TEST_ASSERT_EQUAL_STRING("3", row_text(2).c_str());
+  TEST_ASSERT_EQUAL_STRING("", row_text(4).c_str());
+  TEST_ASSERT_EQUAL_STRING("5", row_text(5).c_str());
+}
+
+static void test_device_status_replies() {
+  feed("\x1b[5n\x1b[4;7H\x1b[6n");
+  TEST_ASSERT_EQUAL_STRING("\x1b[0n\x1b[4;7R", replies.c_str());
+}
+
+static void test_cpr_in_origin_mode() {
+  feed("\x1b[2;20r\x1b[?6h\x1b[3;5H\x1b[6n");
+  TEST_ASSERT_EQUAL_UINT16(3, vt->screen().cursor_row());
+  TEST_ASSERT_EQUAL_STRING("\x1b[3;5R", replies.c_str());
+}
+
+static void test_alt_screen_restores_main() {
+  feed("shell\x1b[?1049hvim");
+  TEST_ASSERT_TRUE(vt->screen().in_alt_screen());
+  // The cursor stays put on the new screen, as in xterm
+  TEST_ASSERT_EQUAL_STRING("     vim", row_text(0).c_str());
+  feed("\x1b[?1049l");
+  TEST_ASSERT_FALSE(vt->screen().in_alt_screen());
+  TEST_ASSERT_EQUAL_STRING("shell", row_text(0).c_str());
+  TEST_ASSERT_EQUAL_UINT16(5, vt->screen().cursor_col());
+}
+
+static void test_restore_without_save_uses_default_pen() {
+  feed("\x1b[31m\x1b[5;5H\x1b" "8A");
+  const TermCell &a = vt->screen().row(0)[0];
+  TEST_ASSERT_EQUAL_UINT16('A', a.glyph);
+  TEST_ASSERT_TRUE(a.flags & TERM_ATTR_DEFAULT_FG);
+  TEST_ASSERT_TRUE(a.flags & TERM_ATTR_DEFAULT_BG);
+
+  // The alternate screen has its own slot, also never saved
+  feed("\x1b[?1049h\x1b[32m\x1b" "8B");
+  const TermCell &b = vt->screen().row(0)[0];
+  TEST_ASSERT_EQUAL_UINT16('B', b.glyph);
+  TEST_ASSERT_TRUE(b.flags & TERM_ATTR_DEFAULT_FG);
+  TEST_ASSERT_TRUE(b.flags & TERM_ATTR_DEFAULT_BG);
+
+  // RIS forgets what was saved
+  feed("\x1b[?1049l\x1b[33m\x1b" "7\x1b" "c\x1b" "8C");
+  TEST_ASSERT_TRUE(vt->screen().row(0)[0].flags & TERM_ATTR_DEFAULT_FG);
+}
+
+static void test_local_text_keeps_host_state() {
+  feed("\x1b[32m\x1b[3");
+  vt->write_local("note\n", 5);
+  // Held: the open sequence must complete on host bytes alone
+  TEST_ASSERT_EQUAL_STRING("", row_text(0).c_str());
+  feed("1mA\r\n");
+  TEST_ASSERT_EQUAL_STRING("A", row_text(0).c_str());
+  TEST_ASSERT_EQUAL_STRING("note", row_text(1).c_str());
+  TEST_ASSERT_TRUE(vt->screen().row(1)[0].flags & TERM_ATTR_DEFAULT_FG);
+  TEST_ASSERT_EQUAL_UINT8(1, vt->screen().pen.fg);
+  TEST_ASSERT_FALSE(vt->screen().newline_mode);
+}
+
+static void test_local_text_under_alt_screen() {
+  feed("$ \x1b[?1049h\x1b[5;10rvim");
+  vt->write_local("[S2] Session closed.\n", 21);
+  TEST_ASSERT_EQUAL_STRING("vim", row_text(0).c_str());
+  feed("\x1b[?1049l");
+  TEST_ASSERT_EQUAL_STRING("$ [S2] Session closed.", row_text(0).c_str());
+  TEST_ASSERT_EQUAL_UINT16(1, vt->screen().cursor_row());
+  TEST_ASSERT_EQUAL_UINT16(0, vt->screen().cursor_col());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_text_and_line_discipline);
+  RUN_TEST(test_cursor_positioning);
+  RUN_TEST(test_sgr_colours);
+  RUN_TEST(test_sequence_split_across_feeds);
+  RUN_TEST(test_erase_in_line);
+  RUN_TEST(test_scroll_region);
+  RUN_TEST(test_device_status_replies);
+  RUN_TEST(test_cpr_in_origin_mode);
+  RUN_TEST(test_alt_screen_restores_main);
+  RUN_TEST(test_restore_without_save_uses_default_pen);
+  RUN_TEST(test_local_text_keeps_host_state);
+  RUN_TEST(test_local_text_under_alt_screen);
+  return UNITY_END();
+}